@@ -1,3 +1,6 @@
+// renderQueue.h packs instance matrices with GLM_GTX_matrix_affine
+#define GLM_ENABLE_EXPERIMENTAL
+
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include<string>
@@ -8,6 +11,13 @@
 
 #include <iostream>
 #include <cmath>
+#include <mutex>
+#include <vector>
+
+#include "sceneGraph.h"
+#include "renderQueue.h"
+#include "windowRuntime.h"
+#include "jobSystem.h"
 
 // SCREEN
 int SCR_WIDTH = 800;
@@ -20,22 +30,37 @@ const char* vertexShaderSource = R"(
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 aNormal;
 
-uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
+// per instance, see InstanceData in renderQueue.h
+// the model matrix is affine and packed: column i of aModel is row i of the 4x4 matrix
+layout (location = 2) in mat3x4 aModel;
+layout (location = 5) in vec4 aColor;
+layout (location = 6) in vec4 aEmissive;
+
+// the only thing that differs between viewports
+layout (std140) uniform ViewBlock
+{
+    mat4 view;
+    mat4 projection;
+    vec4 viewPos;
+};
 
 out vec3 FragPos;
 out vec3 Normal;
+flat out vec3 ObjectColor;
+flat out vec4 Emissive;
 
 void main()
 {
-    vec4 worldPos = model * vec4(aPos, 1.0);
+    vec4 worldPos = vec4(vec4(aPos, 1.0) * aModel, 1.0);
     FragPos = worldPos.xyz;
 
-    // normal matrix
-    mat3 normalMat = transpose(inverse(mat3(model)));
+    // normal matrix; mat3(aModel) is already the transposed 3x3 part
+    mat3 normalMat = inverse(mat3(aModel));
     Normal = normalize(normalMat * aNormal);
 
+    ObjectColor = aColor.rgb;
+    Emissive = aEmissive;
+
     gl_Position = projection * view * worldPos;
 }
 )";
@@ -46,10 +71,15 @@ out vec4 FragColor;
 
 in vec3 FragPos;
 in vec3 Normal;
+flat in vec3 ObjectColor;
+flat in vec4 Emissive;
 
-uniform vec3 viewPos;
-
-uniform vec3 objectColor;
+layout (std140) uniform ViewBlock
+{
+    mat4 view;
+    mat4 projection;
+    vec4 viewPos;
+};
 
 // toggles
 uniform bool enableDir;
@@ -60,10 +90,6 @@ uniform bool enableAmbient;
 uniform bool enableDiffuse;
 uniform bool enableSpecular;
 
-// emissive
-uniform vec3 emissiveColor;
-uniform float emissiveStrength;
-
 // material
 uniform float shininess;
 
@@ -112,7 +138,7 @@ vec3 PhongLight(vec3 lightDir, vec3 lightCol, vec3 N, vec3 V)
 void main()
 {
     vec3 N = normalize(Normal);
-    vec3 V = normalize(viewPos - FragPos);
+    vec3 V = normalize(viewPos.xyz - FragPos);
 
     vec3 lighting = vec3(0.0);
 
@@ -155,10 +181,10 @@ void main()
     }
 
     // base shaded color
-    vec3 shaded = lighting * objectColor;
+    vec3 shaded = lighting * ObjectColor;
 
     // emissive add (acts like glowing light)
-    shaded += emissiveColor * emissiveStrength;
+    shaded += Emissive.rgb * Emissive.a;
 
     FragColor = vec4(shaded, 1.0);
 }
@@ -172,6 +198,13 @@ float lastFrame = 0.0f;
 glm::vec3 busPos = glm::vec3(0.0f, 0.0f, 0.0f);
 float busAngle = 0.0f;
 
+// pivots of the animated parts, in bus local space; the translations are baked at
+// compile time unless GLM is built with SIMD, where its functions are not constexpr
+GLM_CONSTEXPR const glm::vec3 doorHinge = glm::vec3(1.24f, 0.65f, 1.7f);
+GLM_CONSTEXPR const glm::vec3 fanPivot = glm::vec3(0.0f, 1.55f, 0.0f);
+GLM_CONSTEXPR const glm::mat4 doorHingeMatrix = glm::translate(glm::mat4(1.0f), doorHinge);
+GLM_CONSTEXPR const glm::mat4 fanPivotMatrix = glm::translate(glm::mat4(1.0f), fanPivot);
+
 // CAMERA (main free camera)
 glm::vec3 worldUp = glm::vec3(0, 1, 0);
 
@@ -289,45 +322,41 @@ float cubeVertices[] = {
  0.5f,-0.5f,-0.5f,     0,-1,0
 };
 
-// DRAW HELPERS
-void setModel(unsigned int modelLoc, const glm::mat4& m)
+// SCENE
+// one drawable cube of the bus; its node's world matrix already includes the part's scale
+struct BusPart
 {
-    glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(m));
-}
+    int node;
+    int material;
+};
 
-void setColor(unsigned int colorLoc, glm::vec3 c)
+void addPart(SceneGraph& scene, std::vector<BusPart>& parts, MaterialTable& materials,
+    int parent,
+    const glm::mat4& offset,
+    glm::vec3 scale,
+    glm::vec3 color,
+    glm::vec3 eColor = glm::vec3(0),
+    float eStrength = 0.0f)
 {
-    glUniform3f(colorLoc, c.x, c.y, c.z);
+    BusPart part;
+    part.node = scene.addNode(parent, glm::scale(offset, scale));
+    part.material = materials.add(color, eColor, eStrength);
+    parts.push_back(part);
 }
 
-void drawCube(unsigned int VAO,
-    glm::mat4 base,
-    unsigned int modelLoc,
-    unsigned int colorLoc,
+void addPart(SceneGraph& scene, std::vector<BusPart>& parts, MaterialTable& materials,
+    int parent,
+    glm::vec3 offset,
     glm::vec3 scale,
     glm::vec3 color,
-    unsigned int emissiveColorLoc,
-    unsigned int emissiveStrengthLoc,
     glm::vec3 eColor = glm::vec3(0),
     float eStrength = 0.0f)
 {
-    glm::mat4 m = glm::scale(base, scale);
-    setModel(modelLoc, m);
-    setColor(colorLoc, color);
-
-    glUniform3f(emissiveColorLoc, eColor.x, eColor.y, eColor.z);
-    glUniform1f(emissiveStrengthLoc, eStrength);
-
-    glBindVertexArray(VAO);
-    glDrawArrays(GL_TRIANGLES, 0, 36);
+    addPart(scene, parts, materials, parent, glm::translate(glm::mat4(1.0f), offset), scale, color, eColor, eStrength);
 }
 
-void drawWheelFakeCylinder(unsigned int VAO,
-    const glm::mat4& base,
-    unsigned int modelLoc,
-    unsigned int colorLoc,
-    unsigned int emissiveColorLoc,
-    unsigned int emissiveStrengthLoc,
+void addWheelFakeCylinder(SceneGraph& scene, std::vector<BusPart>& parts, MaterialTable& materials,
+    int wheel,
     float radius,
     float width,
     glm::vec3 color)
@@ -336,19 +365,428 @@ void drawWheelFakeCylinder(unsigned int VAO,
     for (int i = 0; i < slices; i++)
     {
         float a = (float)i / (float)slices * 2.0f * 3.1415926f;
-        glm::mat4 m = base;
+        glm::mat4 m(1.0f);
         m = glm::rotate(m, a, glm::vec3(1, 0, 0));
         m = glm::translate(m, glm::vec3(0.0f, radius, 0.0f));
 
-        drawCube(VAO, m, modelLoc, colorLoc,
+        addPart(scene, parts, materials, wheel, m,
             glm::vec3(width, radius * 0.25f, radius * 0.25f),
-            color,
-            emissiveColorLoc, emissiveStrengthLoc);
+            color);
     }
 }
 
+// builds every part of the bus below busNode; the door and fan get their own
+// pivot nodes so the animation only has to touch one local transform each
+void buildBus(SceneGraph& scene, std::vector<BusPart>& parts, MaterialTable& materials, int busNode, int& doorNode, int& fanNode)
+{
+    glm::vec3 bodyColor = glm::vec3(1.0f, 0.45f, 0.05f);
+    glm::vec3 roofColor = glm::vec3(0.95f, 0.95f, 0.95f);
+    glm::vec3 glassColor = glm::vec3(0.10f, 0.20f, 0.30f);
+    glm::vec3 trimColor = glm::vec3(0.15f, 0.15f, 0.15f);
+
+    glm::vec3 lightYellow = glm::vec3(1.00f, 0.95f, 0.60f);
+    glm::vec3 redLight = glm::vec3(0.90f, 0.10f, 0.10f);
+
+    // BODY
+    addPart(scene, parts, materials, busNode, glm::vec3(0.0f, 0.55f, 0.0f),
+        glm::vec3(2.4f, 1.1f, 6.0f),
+        bodyColor);
+
+    // ROOF
+    addPart(scene, parts, materials, busNode, glm::vec3(0.0f, 1.35f, -0.2f),
+        glm::vec3(2.35f, 0.35f, 5.6f),
+        roofColor);
+
+    // FRONT WINDSHIELD
+    addPart(scene, parts, materials, busNode, glm::vec3(0.0f, 1.0f, 3.05f),
+        glm::vec3(2.1f, 1.0f, 0.08f),
+        glassColor);
+    addPart(scene, parts, materials, busNode, glm::vec3(0.0f, 1.55f, 3.05f),
+        glm::vec3(2.1f, 0.15f, 0.10f),
+        trimColor);
+
+    // SIDE WINDOWS
+    for (int i = 0; i < 5; i++)
+    {
+        float z = 2.0f - i * 1.0f;
+
+        addPart(scene, parts, materials, busNode, glm::vec3(-1.22f, 1.15f, z),
+            glm::vec3(0.05f, 0.55f, 0.75f),
+            glassColor);
+        addPart(scene, parts, materials, busNode, glm::vec3(1.22f, 1.15f, z),
+            glm::vec3(0.05f, 0.55f, 0.75f),
+            glassColor);
+    }
+
+    // FRONT BUMPER
+    addPart(scene, parts, materials, busNode, glm::vec3(0.0f, 0.35f, 3.15f),
+        glm::vec3(2.45f, 0.25f, 0.20f),
+        trimColor);
+
+    // HEADLIGHTS (EMISSIVE + also point lights exist)
+    addPart(scene, parts, materials, busNode, glm::vec3(-0.9f, 0.40f, 3.26f),
+        glm::vec3(0.25f, 0.15f, 0.08f),
+        lightYellow,
+        lightYellow, 1.8f); // emissive glow
+    addPart(scene, parts, materials, busNode, glm::vec3(0.9f, 0.40f, 3.26f),
+        glm::vec3(0.25f, 0.15f, 0.08f),
+        lightYellow,
+        lightYellow, 1.8f);
+
+    // REAR LIGHTS (EMISSIVE)
+    addPart(scene, parts, materials, busNode, glm::vec3(-0.95f, 0.50f, -3.05f),
+        glm::vec3(0.18f, 0.18f, 0.08f),
+        redLight,
+        redLight, 1.2f);
+    addPart(scene, parts, materials, busNode, glm::vec3(0.95f, 0.50f, -3.05f),
+        glm::vec3(0.18f, 0.18f, 0.08f),
+        redLight,
+        redLight, 1.2f);
+
+    // DOOR (hinge)
+    doorNode = scene.addNode(busNode, doorHingeMatrix);
+    addPart(scene, parts, materials, doorNode, glm::vec3(-0.10f, 0.0f, 0.0f),
+        glm::vec3(0.10f, 1.0f, 0.70f),
+        glm::vec3(0.25f, 0.25f, 0.70f));
+
+    // WHEELS
+    float wheelRadius = 0.45f;
+    float wheelWidth = 0.22f;
+
+    glm::vec3 wheelPos[4] = {
+        glm::vec3(-1.15f, 0.20f,  2.20f),
+        glm::vec3(1.15f, 0.20f,  2.20f),
+        glm::vec3(-1.15f, 0.20f, -2.20f),
+        glm::vec3(1.15f, 0.20f, -2.20f)
+    };
+
+    for (int i = 0; i < 4; i++)
+    {
+        int wheel = scene.addNode(busNode, glm::translate(glm::mat4(1.0f), wheelPos[i]));
+        addPart(scene, parts, materials, wheel, glm::mat4(1.0f),
+            glm::vec3(wheelWidth, wheelRadius * 1.2f, wheelRadius * 1.2f),
+            glm::vec3(0.05f, 0.05f, 0.05f));
+
+        addWheelFakeCylinder(scene, parts, materials, wheel,
+            wheelRadius, wheelWidth,
+            glm::vec3(0.08f, 0.08f, 0.08f));
+    }
+
+    // FAN (inside)
+    fanNode = scene.addNode(busNode, fanPivotMatrix);
+    addPart(scene, parts, materials, fanNode, glm::mat4(1.0f),
+        glm::vec3(1.0f, 0.05f, 0.12f),
+        glm::vec3(0.92f, 0.92f, 0.92f),
+        glm::vec3(0.65f, 0.75f, 1.0f), 0.25f);
+    addPart(scene, parts, materials, fanNode, glm::rotate(glm::mat4(1.0f), glm::radians(90.0f), glm::vec3(0, 1, 0)),
+        glm::vec3(1.0f, 0.05f, 0.12f),
+        glm::vec3(0.92f, 0.92f, 0.92f),
+        glm::vec3(0.65f, 0.75f, 1.0f), 0.25f);
+}
+
+// FRAME STATE
+// per view data of the ViewBlock uniform block (std140)
+struct ViewBlock
+{
+    glm::mat4 view;
+    glm::mat4 projection;
+    glm::vec4 viewPos;
+};
+const int VIEW_COUNT = 4;
+
+// everything the lighting uniforms depend on, captured once per frame
+struct LightState
+{
+    glm::mat4 busMatrix;
+    glm::vec3 spotPos, spotDir;
+    bool dir, points, spot;
+    bool ambient, diffuse, specular;
+};
+
+struct LightLocations
+{
+    int enableDir, enablePoints, enableSpot;
+    int ambient, diffuse, specular;
+    int shininess;
+    int dirDirection, dirColor;
+    int spotPos, spotDir, spotColor, spotCutoff;
+    int pointPos[4], pointColor[4];
+};
+
+LightLocations getLightLocations(unsigned int program)
+{
+    LightLocations loc;
+    loc.enableDir = glGetUniformLocation(program, "enableDir");
+    loc.enablePoints = glGetUniformLocation(program, "enablePoints");
+    loc.enableSpot = glGetUniformLocation(program, "enableSpot");
+
+    loc.ambient = glGetUniformLocation(program, "enableAmbient");
+    loc.diffuse = glGetUniformLocation(program, "enableDiffuse");
+    loc.specular = glGetUniformLocation(program, "enableSpecular");
+
+    loc.shininess = glGetUniformLocation(program, "shininess");
+
+    loc.dirDirection = glGetUniformLocation(program, "dirLightDirection");
+    loc.dirColor = glGetUniformLocation(program, "dirLightColor");
+
+    loc.spotPos = glGetUniformLocation(program, "spotPos");
+    loc.spotDir = glGetUniformLocation(program, "spotDir");
+    loc.spotColor = glGetUniformLocation(program, "spotColor");
+    loc.spotCutoff = glGetUniformLocation(program, "spotCutoff");
+
+    // point arrays -> build uniform names
+    for (int i = 0; i < 4; i++)
+    {
+        std::string p1 = "pointPos[" + std::to_string(i) + "]";
+        std::string p2 = "pointColor[" + std::to_string(i) + "]";
+        loc.pointPos[i] = glGetUniformLocation(program, p1.c_str());
+        loc.pointColor[i] = glGetUniformLocation(program, p2.c_str());
+    }
+    return loc;
+}
+
+LightState captureLights(const glm::mat4& busMatrix)
+{
+    LightState s;
+    s.busMatrix = busMatrix;
+    s.spotPos = camPos;
+    s.spotDir = camFront;
+    s.dir = enableDir;
+    s.points = enablePoints;
+    s.spot = enableSpot;
+    s.ambient = enableAmbient;
+    s.diffuse = enableDiffuse;
+    s.specular = enableSpecular;
+    return s;
+}
+
+// the program must be in use
+void setLightUniforms(const LightLocations& loc, const LightState& s)
+{
+    // lighting toggle uniforms
+    glUniform1i(loc.enableDir, s.dir);
+    glUniform1i(loc.enablePoints, s.points);
+    glUniform1i(loc.enableSpot, s.spot);
+
+    glUniform1i(loc.ambient, s.ambient);
+    glUniform1i(loc.diffuse, s.diffuse);
+    glUniform1i(loc.specular, s.specular);
+
+    glUniform1f(loc.shininess, 32.0f);
+
+    // set global lights
+    glUniform3f(loc.dirDirection, -0.4f, -1.0f, -0.3f);
+    glUniform3f(loc.dirColor, 0.9f, 0.9f, 0.9f);
+
+    // spot: from camera like flashlight
+    glUniform3f(loc.spotPos, s.spotPos.x, s.spotPos.y, s.spotPos.z);
+    glUniform3f(loc.spotDir, s.spotDir.x, s.spotDir.y, s.spotDir.z);
+    glUniform3f(loc.spotColor, 1.0f, 0.95f, 0.80f);
+    glUniform1f(loc.spotCutoff, cos(glm::radians(14.0f))); // single cutoff angle
+
+    // point lights in bus local positions -> convert to world
+    glm::vec3 localPoints[4] = {
+        glm::vec3(-0.9f, 0.40f, 3.26f), // left headlight
+        glm::vec3(0.9f, 0.40f, 3.26f), // right headlight
+        glm::vec3(0.0f, 1.55f, 0.0f),  // inside roof light area
+        glm::vec3(0.0f, 0.40f,-3.10f)  // rear area light
+    };
+
+    glm::vec3 pointCols[4] = {
+        glm::vec3(1.0f, 0.95f, 0.75f),
+        glm::vec3(1.0f, 0.95f, 0.75f),
+        glm::vec3(0.65f, 0.75f, 1.0f),
+        glm::vec3(1.0f, 0.25f, 0.25f)
+    };
+
+    for (int i = 0; i < 4; i++)
+    {
+        glm::vec4 w = s.busMatrix * glm::vec4(localPoints[i], 1.0f);
+        glUniform3f(loc.pointPos[i], w.x, w.y, w.z);
+        glUniform3f(loc.pointColor[i], pointCols[i].x, pointCols[i].y, pointCols[i].z);
+    }
+}
+
+// advances the animations and camera modes by deltaTime
+void animate()
+{
+    // animations
+    if (fanOn)
+    {
+        fanAngle += 360.0f * deltaTime;
+        if (fanAngle > 360.0f) fanAngle -= 360.0f;
+    }
+
+    float doorSpeed = 120.0f;
+    if (doorOpen && doorAngle < 75.0f) doorAngle += doorSpeed * deltaTime;
+    if (!doorOpen && doorAngle > 0.0f) doorAngle -= doorSpeed * deltaTime;
+
+    // camera modes
+    glm::vec3 target = busPos + glm::vec3(0, 0.8f, 0);
+
+    if (birdEyeMode)
+    {
+        camPos = busPos + glm::vec3(0.0f, 22.0f, 0.01f);
+        camFront = glm::normalize(target - camPos);
+        camRight = glm::normalize(glm::cross(camFront, worldUp));
+        camUp = glm::normalize(glm::cross(camRight, camFront));
+    }
+    else if (orbitMode)
+    {
+        orbitAngle += 35.0f * deltaTime;
+        float rad = glm::radians(orbitAngle);
+
+        camPos.x = target.x + orbitRadius * cos(rad);
+        camPos.z = target.z + orbitRadius * sin(rad);
+        camPos.y = target.y + 7.0f;
+
+        camFront = glm::normalize(target - camPos);
+        camRight = glm::normalize(glm::cross(camFront, worldUp));
+        camUp = glm::normalize(glm::cross(camRight, camFront));
+
+        if (fabs(camRoll) > 0.0001f)
+        {
+            glm::mat4 r = glm::rotate(glm::mat4(1.0f), glm::radians(camRoll), camFront);
+            camUp = glm::normalize(glm::vec3(r * glm::vec4(camUp, 0.0f)));
+            camRight = glm::normalize(glm::cross(camFront, camUp));
+        }
+    }
+}
+
+// moves the bus, door and fan nodes to the animated state and updates the scene;
+// returns the bus matrix
+glm::mat4 updateTransforms(SceneGraph& scene, int busNode, int doorNode, int fanNode)
+{
+    // bus master
+    glm::mat4 busMatrix(1.0f);
+    busMatrix = glm::translate(busMatrix, busPos);
+    busMatrix = glm::rotate(busMatrix, glm::radians(busAngle), glm::vec3(0, 1, 0));
+    scene.setLocal(busNode, busMatrix);
+
+    glm::mat4 doorMatrix = glm::rotate(doorHingeMatrix, glm::radians(doorAngle), glm::vec3(0, 1, 0));
+    scene.setLocal(doorNode, doorMatrix);
+
+    glm::mat4 fanMatrix = glm::rotate(fanPivotMatrix, glm::radians(fanAngle), glm::vec3(0, 1, 0));
+    scene.setLocal(fanNode, fanMatrix);
+
+    // only the subtrees whose transform changed are recomputed
+    scene.update();
+    return busMatrix;
+}
+
+glm::mat4 updateScene(SceneGraph& scene, int busNode, int doorNode, int fanNode)
+{
+    animate();
+    return updateTransforms(scene, busNode, doorNode, fanNode);
+}
+
+// Views:
+// 0: Combined lighting (free cam)
+// 1: Top view (isometric-ish)
+// 2: Front view
+// 3: Inside view
+void computeView(int vp, const glm::mat4& busMatrix, float aspect, ViewBlock& block)
+{
+    glm::vec3 target = busPos + glm::vec3(0, 0.8f, 0);
+    glm::vec3 vpos, vfront, vup;
+
+    if (vp == 0)
+    {
+        vpos = camPos;
+        vfront = camFront;
+        vup = camUp;
+
+        // combined
+    }
+    else if (vp == 1)
+    {
+        // top view
+        vpos = busPos + glm::vec3(0.0f, 25.0f, 0.01f);
+        vfront = glm::normalize(target - vpos);
+        glm::vec3 right = glm::normalize(glm::cross(vfront, worldUp));
+        vup = glm::normalize(glm::cross(right, vfront));
+    }
+    else if (vp == 2)
+    {
+        // front view
+        vpos = busPos + glm::vec3(0.0f, 4.0f, 20.0f);
+        vfront = glm::normalize(target - vpos);
+        glm::vec3 right = glm::normalize(glm::cross(vfront, worldUp));
+        vup = glm::normalize(glm::cross(right, vfront));
+    }
+    else
+    {
+        // inside view: near front inside cabin
+        glm::vec3 insideLocal(0.0f, 1.2f, 2.0f);
+        glm::vec4 insideWorld = busMatrix * glm::vec4(insideLocal, 1.0f);
+        vpos = glm::vec3(insideWorld);
+        glm::vec3 lookLocal(0.0f, 1.2f, -3.0f);
+        glm::vec4 lookWorld = busMatrix * glm::vec4(lookLocal, 1.0f);
+        vfront = glm::normalize(glm::vec3(lookWorld) - vpos);
+
+        glm::vec3 right = glm::normalize(glm::cross(vfront, worldUp));
+        vup = glm::normalize(glm::cross(right, vfront));
+    }
+
+    //OWN lookAt
+    block.view = myLookAt(vpos, vpos + vfront, vup);
+    block.projection = glm::perspective(glm::radians(45.0f), aspect, 0.1f, 300.0f);
+    block.viewPos = glm::vec4(vpos, 1.0f);
+}
+
+// the six planes of a view frustum, normals pointing inwards
+struct Frustum
+{
+    glm::vec4 planes[6];
+};
+
+// planes straight from the rows of projection * view (Gribb/Hartmann)
+Frustum extractFrustum(const glm::mat4& viewProjection)
+{
+    glm::mat4 rows = glm::transpose(viewProjection);
+    Frustum f;
+    f.planes[0] = rows[3] + rows[0];
+    f.planes[1] = rows[3] - rows[0];
+    f.planes[2] = rows[3] + rows[1];
+    f.planes[3] = rows[3] - rows[1];
+    f.planes[4] = rows[3] + rows[2];
+    f.planes[5] = rows[3] - rows[2];
+    for (int i = 0; i < 6; i++)
+        f.planes[i] /= glm::length(glm::vec3(f.planes[i]));
+    return f;
+}
+
+// tests the sphere around the unit cube the model matrix places
+bool cubeVisible(const Frustum& f, const glm::mat4& model)
+{
+    glm::vec3 center(model[3]);
+    float radius = 0.5f * sqrt(glm::dot(glm::vec3(model[0]), glm::vec3(model[0]))
+        + glm::dot(glm::vec3(model[1]), glm::vec3(model[1]))
+        + glm::dot(glm::vec3(model[2]), glm::vec3(model[2])));
+
+    for (int i = 0; i < 6; i++)
+        if (glm::dot(glm::vec3(f.planes[i]), center) + f.planes[i].w < -radius)
+            return false;
+    return true;
+}
+
+// sets up the cube geometry in the bound VAO, reading positions and normals from VBO
+void setUpCubeAttributes(unsigned int VBO)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+
+    // pos
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    // normal
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+}
+
+int runWindows();
+
 // MAIN
-int main()
+int main(int argc, char** argv)
 {
     std::cout <<
         "==== Assignment B2 Controls ====\n"
@@ -369,6 +807,8 @@ int main()
         "5 : Toggle Ambient\n"
         "6 : Toggle Diffuse\n"
         "7 : Toggle Specular\n"
+        "--------------------------------\n"
+        "Run with --windows to show every view in a window of its own\n"
         "================================\n";
 
     glfwInit();
@@ -376,6 +816,9 @@ int main()
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+    if (argc > 1 && std::string(argv[1]) == "--windows")
+        return runWindows();
+
     GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Assignment B2 - Bus Lighting + 4 Viewports", NULL, NULL);
     if (!window)
     {
@@ -404,403 +847,333 @@ int main()
     glBindVertexArray(VAO);
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
     glBufferData(GL_ARRAY_BUFFER, sizeof(cubeVertices), cubeVertices, GL_STATIC_DRAW);
-
-    // pos
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    // normal
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
+    setUpCubeAttributes(VBO);
+
+    // per instance data: model matrix, color and emissive, refilled once per frame;
+    // every viewport culls on its own, so each has its own buffer
+    unsigned int instanceVBOs[VIEW_COUNT];
+    glGenBuffers(VIEW_COUNT, instanceVBOs);
+
+    // per view data: one ViewBlock per viewport in a single buffer, each aligned
+    // so a viewport only has to bind its range
+    GLint uboAlignment = 256;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uboAlignment);
+    GLsizeiptr viewStride = ((sizeof(ViewBlock) + uboAlignment - 1) / uboAlignment) * uboAlignment;
+    std::vector<unsigned char> viewData(viewStride * VIEW_COUNT);
+
+    unsigned int viewUBO;
+    glGenBuffers(1, &viewUBO);
+    glBindBuffer(GL_UNIFORM_BUFFER, viewUBO);
+    glBufferData(GL_UNIFORM_BUFFER, viewData.size(), NULL, GL_STREAM_DRAW);
+    glUniformBlockBinding(shaderProgram, glGetUniformBlockIndex(shaderProgram, "ViewBlock"), 0);
 
     // uniforms
-    unsigned int modelLoc = glGetUniformLocation(shaderProgram, "model");
-    unsigned int viewLoc = glGetUniformLocation(shaderProgram, "view");
-    unsigned int projLoc = glGetUniformLocation(shaderProgram, "projection");
-    unsigned int colorLoc = glGetUniformLocation(shaderProgram, "objectColor");
-
-    unsigned int viewPosLoc = glGetUniformLocation(shaderProgram, "viewPos");
-
-    unsigned int enableDirLoc = glGetUniformLocation(shaderProgram, "enableDir");
-    unsigned int enablePointsLoc = glGetUniformLocation(shaderProgram, "enablePoints");
-    unsigned int enableSpotLoc = glGetUniformLocation(shaderProgram, "enableSpot");
-
-    unsigned int ambLoc = glGetUniformLocation(shaderProgram, "enableAmbient");
-    unsigned int difLoc = glGetUniformLocation(shaderProgram, "enableDiffuse");
-    unsigned int speLoc = glGetUniformLocation(shaderProgram, "enableSpecular");
-
-    unsigned int shinLoc = glGetUniformLocation(shaderProgram, "shininess");
-
-    unsigned int emissiveColorLoc = glGetUniformLocation(shaderProgram, "emissiveColor");
-    unsigned int emissiveStrengthLoc = glGetUniformLocation(shaderProgram, "emissiveStrength");
-
-    // light uniforms
-    unsigned int dirDirLoc = glGetUniformLocation(shaderProgram, "dirLightDirection");
-    unsigned int dirColLoc = glGetUniformLocation(shaderProgram, "dirLightColor");
-
-    unsigned int spotPosLoc = glGetUniformLocation(shaderProgram, "spotPos");
-    unsigned int spotDirLoc = glGetUniformLocation(shaderProgram, "spotDir");
-    unsigned int spotColLoc = glGetUniformLocation(shaderProgram, "spotColor");
-    unsigned int spotCutLoc = glGetUniformLocation(shaderProgram, "spotCutoff");
-
-    // point arrays -> build uniform names
-    int pointPosLoc[4];
-    int pointColLoc[4];
-    for (int i = 0; i < 4; i++)
-    {
-        std::string p1 = "pointPos[" + std::to_string(i) + "]";
-        std::string p2 = "pointColor[" + std::to_string(i) + "]";
-        pointPosLoc[i] = glGetUniformLocation(shaderProgram, p1.c_str());
-        pointColLoc[i] = glGetUniformLocation(shaderProgram, p2.c_str());
-    }
+    LightLocations lightLoc = getLightLocations(shaderProgram);
 
     // init camera vectors
     updateCameraVectors();
 
+    // scene: parts are built once, the loop only updates the nodes that move
+    SceneGraph scene;
+    std::vector<BusPart> busParts;
+    MaterialTable materials;
+    int busNode = scene.addNode(-1);
+    int doorNode, fanNode;
+    buildBus(scene, busParts, materials, busNode, doorNode, fanNode);
+
+    // draws are sorted by program, material, VAO and depth, then batched into instanced draws
+    RenderQueue renderQueues[VIEW_COUNT];
+    Frustum frustums[VIEW_COUNT];
+    std::vector<unsigned char> visible(VIEW_COUNT * busParts.size());
+    glm::mat4 busMatrix(1.0f);
+    LightState lights;
+    float statsTimer = 0.0f;
+    int statsFrames = 0;
+
+    // the frame is a task graph: animation, the scene update, views, culling and
+    // queue building run on the job system, the GL work stays on this thread
+    JobSystem jobs;
+    TaskProfile profile;
+    jobs.setTimingHook([&profile](const JobSystem::TaskTiming& t) { profile.record(t); });
+    std::cout << "job system: " << jobs.threadCount() << " threads\n";
+
     while (!glfwWindowShouldClose(window))
     {
         float currentFrame = (float)glfwGetTime();
         deltaTime = currentFrame - lastFrame;
         lastFrame = currentFrame;
 
+        // GLFW input is main thread only, so it happens before the graph runs
         processInput(window);
 
-        // animations
-        if (fanOn)
-        {
-            fanAngle += 360.0f * deltaTime;
-            if (fanAngle > 360.0f) fanAngle -= 360.0f;
-        }
-
-        float doorSpeed = 120.0f;
-        if (doorOpen && doorAngle < 75.0f) doorAngle += doorSpeed * deltaTime;
-        if (!doorOpen && doorAngle > 0.0f) doorAngle -= doorSpeed * deltaTime;
-
-        // camera modes
-        glm::vec3 target = busPos + glm::vec3(0, 0.8f, 0);
+        // 4 VIEWPORTS
+        int halfW = SCR_WIDTH / 2;
+        int halfH = SCR_HEIGHT / 2;
+        float aspect = (float)halfW / (float)halfH;
+        size_t partCount = busParts.size();
 
-        if (birdEyeMode)
-        {
-            camPos = busPos + glm::vec3(0.0f, 22.0f, 0.01f);
-            camFront = glm::normalize(target - camPos);
-            camRight = glm::normalize(glm::cross(camFront, worldUp));
-            camUp = glm::normalize(glm::cross(camRight, camFront));
-        }
-        else if (orbitMode)
-        {
-            orbitAngle += 35.0f * deltaTime;
-            float rad = glm::radians(orbitAngle);
+        JobSystem::TaskId animation = jobs.add("animate", [&] { animate(); });
 
-            camPos.x = target.x + orbitRadius * cos(rad);
-            camPos.z = target.z + orbitRadius * sin(rad);
-            camPos.y = target.y + 7.0f;
+        JobSystem::TaskId transforms = jobs.add("scene", [&] {
+            busMatrix = updateTransforms(scene, busNode, doorNode, fanNode);
+        }, { animation });
 
-            camFront = glm::normalize(target - camPos);
-            camRight = glm::normalize(glm::cross(camFront, worldUp));
-            camUp = glm::normalize(glm::cross(camRight, camFront));
+        JobSystem::TaskId lighting = jobs.add("lights", [&] { lights = captureLights(busMatrix); }, { transforms });
 
-            if (fabs(camRoll) > 0.0001f)
+        JobSystem::TaskId views = jobs.addParallelFor("views", VIEW_COUNT, 1, [&](size_t begin, size_t end) {
+            for (size_t vp = begin; vp < end; vp++)
             {
-                glm::mat4 r = glm::rotate(glm::mat4(1.0f), glm::radians(camRoll), camFront);
-                camUp = glm::normalize(glm::vec3(r * glm::vec4(camUp, 0.0f)));
-                camRight = glm::normalize(glm::cross(camFront, camUp));
+                ViewBlock& block = *(ViewBlock*)&viewData[vp * viewStride];
+                computeView((int)vp, busMatrix, aspect, block);
+                frustums[vp] = extractFrustum(block.projection * block.view);
             }
-        }
+        }, { transforms });
 
-        // clear once
-        glClearColor(0.06f, 0.06f, 0.08f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        // one item per part and viewport
+        JobSystem::TaskId culling = jobs.addParallelFor("cull", VIEW_COUNT * partCount, 64, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+                visible[i] = cubeVisible(frustums[i / partCount], scene.world(busParts[i % partCount].node));
+        }, { views });
 
-        glUseProgram(shaderProgram);
-
-        // lighting toggle uniforms
-        glUniform1i(enableDirLoc, enableDir);
-        glUniform1i(enablePointsLoc, enablePoints);
-        glUniform1i(enableSpotLoc, enableSpot);
-
-        glUniform1i(ambLoc, enableAmbient);
-        glUniform1i(difLoc, enableDiffuse);
-        glUniform1i(speLoc, enableSpecular);
-
-        glUniform1f(shinLoc, 32.0f);
-
-        // set global lights
-        glUniform3f(dirDirLoc, -0.4f, -1.0f, -0.3f);
-        glUniform3f(dirColLoc, 0.9f, 0.9f, 0.9f);
+        // every viewport sorts front to back for its own view
+        JobSystem::TaskId queues = jobs.addParallelFor("build", VIEW_COUNT, 1, [&](size_t begin, size_t end) {
+            for (size_t vp = begin; vp < end; vp++)
+            {
+                const glm::mat4& view = ((ViewBlock*)&viewData[vp * viewStride])->view;
+                RenderQueue& queue = renderQueues[vp];
+                queue.clear();
+                for (size_t i = 0; i < partCount; i++)
+                {
+                    if (!visible[vp * partCount + i])
+                        continue;
+                    const BusPart& part = busParts[i];
+                    const glm::mat4& model = scene.world(part.node);
+                    float depth = -(view * model[3]).z;
+                    queue.push(shaderProgram, part.material, VAO, depth, 300.0f, &model, 0, 36);
+                }
+                queue.sort();
+                queue.buildInstances(materials);
+            }
+        }, { culling });
 
-        // spot: from camera like flashlight
-        glUniform3f(spotPosLoc, camPos.x, camPos.y, camPos.z);
-        glUniform3f(spotDirLoc, camFront.x, camFront.y, camFront.z);
-        glUniform3f(spotColLoc, 1.0f, 0.95f, 0.80f);
-        glUniform1f(spotCutLoc, cos(glm::radians(14.0f))); // single cutoff angle
+        jobs.addOnCaller("submit", [&] {
+            // clear once
+            glClearColor(0.06f, 0.06f, 0.08f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        // bus master
-        glm::mat4 busMatrix(1.0f);
-        busMatrix = glm::translate(busMatrix, busPos);
-        busMatrix = glm::rotate(busMatrix, glm::radians(busAngle), glm::vec3(0, 1, 0));
+            glUseProgram(shaderProgram);
+            setLightUniforms(lightLoc, lights);
 
-        // point lights in bus local positions -> convert to world
-        glm::vec3 localPoints[4] = {
-            glm::vec3(-0.9f, 0.40f, 3.26f), // left headlight
-            glm::vec3(0.9f, 0.40f, 3.26f), // right headlight
-            glm::vec3(0.0f, 1.55f, 0.0f),  // inside roof light area
-            glm::vec3(0.0f, 0.40f,-3.10f)  // rear area light
-        };
+            // all views go up in one upload; orphaning keeps it from waiting on last frame
+            glBindBuffer(GL_UNIFORM_BUFFER, viewUBO);
+            glBufferData(GL_UNIFORM_BUFFER, viewData.size(), NULL, GL_STREAM_DRAW);
+            glBufferSubData(GL_UNIFORM_BUFFER, 0, viewData.size(), viewData.data());
 
-        glm::vec3 pointCols[4] = {
-            glm::vec3(1.0f, 0.95f, 0.75f),
-            glm::vec3(1.0f, 0.95f, 0.75f),
-            glm::vec3(0.65f, 0.75f, 1.0f),
-            glm::vec3(1.0f, 0.25f, 0.25f)
-        };
+            // each viewport draws its own culled queue with its view block
+            for (int vp = 0; vp < VIEW_COUNT; vp++)
+            {
+                int x = (vp % 2) * halfW;
+                int y = (vp / 2) * halfH;
+                glViewport(x, y, halfW, halfH);
 
-        for (int i = 0; i < 4; i++)
-        {
-            glm::vec4 w = busMatrix * glm::vec4(localPoints[i], 1.0f);
-            glUniform3f(pointPosLoc[i], w.x, w.y, w.z);
-            glUniform3f(pointColLoc[i], pointCols[i].x, pointCols[i].y, pointCols[i].z);
-        }
+                glBindBufferRange(GL_UNIFORM_BUFFER, 0, viewUBO, vp * viewStride, sizeof(ViewBlock));
+                renderQueues[vp].uploadInstances(instanceVBOs[vp]);
+                renderQueues[vp].submitInstanced(instanceVBOs[vp], 2);
+            }
+        }, { lighting, queues });
 
-        // 4 VIEWPORTS
-        int halfW = SCR_WIDTH / 2;
-        int halfH = SCR_HEIGHT / 2;
+        jobs.run();
 
-        // Views:
-        // 0: Combined lighting (free cam)
-        // 1: Top view (isometric-ish)
-        // 2: Front view
-        // 3: Inside view
-        for (int vp = 0; vp < 4; vp++)
+        // report how much state the queues elided and what the tasks took per frame, averaged over a second
+        statsTimer += deltaTime;
+        statsFrames++;
+        if (statsTimer >= 1.0f)
         {
-            int x = (vp % 2) * halfW;
-            int y = (vp / 2) * halfH;
-            glViewport(x, y, halfW, halfH);
-
-            float aspect = (float)halfW / (float)halfH;
-            glm::mat4 projection = glm::perspective(glm::radians(45.0f), aspect, 0.1f, 300.0f);
-
-            glm::mat4 view;
-
-            glm::vec3 vpos, vfront, vup;
-
-            if (vp == 0)
+            RenderQueueStats stats = {};
+            for (int vp = 0; vp < VIEW_COUNT; vp++)
             {
-                vpos = camPos;
-                vfront = camFront;
-                vup = camUp;
-
-                // combined
-            }
-            else if (vp == 1)
-            {
-                // top view
-                vpos = busPos + glm::vec3(0.0f, 25.0f, 0.01f);
-                vfront = glm::normalize(target - vpos);
-                glm::vec3 right = glm::normalize(glm::cross(vfront, worldUp));
-                vup = glm::normalize(glm::cross(right, vfront));
-            }
-            else if (vp == 2)
-            {
-                // front view
-                vpos = busPos + glm::vec3(0.0f, 4.0f, 20.0f);
-                vfront = glm::normalize(target - vpos);
-                glm::vec3 right = glm::normalize(glm::cross(vfront, worldUp));
-                vup = glm::normalize(glm::cross(right, vfront));
-            }
-            else
-            {
-                // inside view: near front inside cabin
-                glm::vec3 insideLocal(0.0f, 1.2f, 2.0f);
-                glm::vec4 insideWorld = busMatrix * glm::vec4(insideLocal, 1.0f);
-                vpos = glm::vec3(insideWorld);
-                glm::vec3 lookLocal(0.0f, 1.2f, -3.0f);
-                glm::vec4 lookWorld = busMatrix * glm::vec4(lookLocal, 1.0f);
-                vfront = glm::normalize(glm::vec3(lookWorld) - vpos);
-
-                glm::vec3 right = glm::normalize(glm::cross(vfront, worldUp));
-                vup = glm::normalize(glm::cross(right, vfront));
+                RenderQueueStats s = renderQueues[vp].takeStats();
+                stats.draws += s.draws;
+                stats.programBinds += s.programBinds;
+                stats.vaoBinds += s.vaoBinds;
+                stats.bindsSaved += s.bindsSaved;
             }
+            std::cout << "render queue: " << stats.draws / statsFrames << " draws, "
+                << (stats.programBinds + stats.vaoBinds) / statsFrames << " binds, "
+                << stats.bindsSaved / statsFrames << " binds saved per frame\n";
+            profile.report(std::cout, statsFrames);
+            statsTimer = 0.0f;
+            statsFrames = 0;
+        }
 
-            //OWN lookAt
-            view = myLookAt(vpos, vpos + vfront, vup);
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+    }
 
-            glUniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(projection));
-            glUniformMatrix4fv(viewLoc, 1, GL_FALSE, glm::value_ptr(view));
-            glUniform3f(viewPosLoc, vpos.x, vpos.y, vpos.z);
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteBuffers(1, &VBO);
+    glDeleteBuffers(VIEW_COUNT, instanceVBOs);
+    glDeleteBuffers(1, &viewUBO);
+    glDeleteProgram(shaderProgram);
 
-          
-            // DRAW SCENE (BUS)
-            
-            glm::vec3 bodyColor = glm::vec3(1.0f, 0.45f, 0.05f);
-            glm::vec3 roofColor = glm::vec3(0.95f, 0.95f, 0.95f);
-            glm::vec3 glassColor = glm::vec3(0.10f, 0.20f, 0.30f);
-            glm::vec3 trimColor = glm::vec3(0.15f, 0.15f, 0.15f);
+    glfwTerminate();
+    return 0;
+}
 
-            glm::vec3 lightYellow = glm::vec3(1.00f, 0.95f, 0.60f);
-            glm::vec3 redLight = glm::vec3(0.90f, 0.10f, 0.10f);
+// MULTI WINDOW
+// what the main thread hands the render threads every tick
+struct FrameSnapshot
+{
+    ViewBlock views[VIEW_COUNT];
+    LightState lights;
+    std::vector<glm::mat4> partWorlds;
+};
 
-            // BODY
-            {
-                glm::mat4 m = glm::translate(busMatrix, glm::vec3(0.0f, 0.55f, 0.0f));
-                drawCube(VAO, m, modelLoc, colorLoc,
-                    glm::vec3(2.4f, 1.1f, 6.0f),
-                    bodyColor,
-                    emissiveColorLoc, emissiveStrengthLoc);
-            }
+// the objects one view window owns in its own context
+struct ViewRenderer
+{
+    unsigned int program;
+    unsigned int VAO;
+    unsigned int instanceVBO;
+    unsigned int viewUBO;
+    LightLocations lightLoc;
+    RenderQueue queue;
+    FrameSnapshot frame;
+};
 
-            // ROOF
-            {
-                glm::mat4 m = glm::translate(busMatrix, glm::vec3(0.0f, 1.35f, -0.2f));
-                drawCube(VAO, m, modelLoc, colorLoc,
-                    glm::vec3(2.35f, 0.35f, 5.6f),
-                    roofColor,
-                    emissiveColorLoc, emissiveStrengthLoc);
-            }
+// every view in a window of its own, each drawn by its own thread; the main thread
+// handles input and animation and publishes a snapshot the windows draw from
+int runWindows()
+{
+    WindowRuntime runtime;
+    if (!runtime.init())
+    {
+        glfwTerminate();
+        return -1;
+    }
 
-            // FRONT WINDSHIELD
-            {
-                glm::mat4 m = glm::translate(busMatrix, glm::vec3(0.0f, 1.0f, 3.05f));
-                drawCube(VAO, m, modelLoc, colorLoc,
-                    glm::vec3(2.1f, 1.0f, 0.08f),
-                    glassColor,
-                    emissiveColorLoc, emissiveStrengthLoc);
-
-                glm::mat4 m2 = glm::translate(busMatrix, glm::vec3(0.0f, 1.55f, 3.05f));
-                drawCube(VAO, m2, modelLoc, colorLoc,
-                    glm::vec3(2.1f, 0.15f, 0.10f),
-                    trimColor,
-                    emissiveColorLoc, emissiveStrengthLoc);
-            }
+    // the scene is CPU only and owned by the main thread
+    updateCameraVectors();
+    SceneGraph scene;
+    std::vector<BusPart> busParts;
+    MaterialTable materials;
+    int busNode = scene.addNode(-1);
+    int doorNode, fanNode;
+    buildBus(scene, busParts, materials, busNode, doorNode, fanNode);
+
+    // the cube geometry is the one object every window shares
+    unsigned int cubeVBO = 0;
+    uint64_t cubeTicket = runtime.upload([&cubeVBO] {
+        glGenBuffers(1, &cubeVBO);
+        glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(cubeVertices), cubeVertices, GL_STATIC_DRAW);
+    });
+
+    std::mutex snapshotMutex;
+    FrameSnapshot snapshot;
+
+    const char* titles[VIEW_COUNT] = { "Bus - Free camera", "Bus - Top", "Bus - Front", "Bus - Inside" };
+    GLFWwindow* windows[VIEW_COUNT];
+    ViewRenderer renderers[VIEW_COUNT];
+
+    for (int vp = 0; vp < VIEW_COUNT; vp++)
+    {
+        ViewRenderer* r = &renderers[vp];
 
-            // SIDE WINDOWS
-            for (int i = 0; i < 5; i++)
-            {
-                float z = 2.0f - i * 1.0f;
-
-                glm::mat4 mL = glm::translate(busMatrix, glm::vec3(-1.22f, 1.15f, z));
-                drawCube(VAO, mL, modelLoc, colorLoc,
-                    glm::vec3(0.05f, 0.55f, 0.75f),
-                    glassColor,
-                    emissiveColorLoc, emissiveStrengthLoc);
-
-                glm::mat4 mR = glm::translate(busMatrix, glm::vec3(1.22f, 1.15f, z));
-                drawCube(VAO, mR, modelLoc, colorLoc,
-                    glm::vec3(0.05f, 0.55f, 0.75f),
-                    glassColor,
-                    emissiveColorLoc, emissiveStrengthLoc);
-            }
+        RenderCallback onInit = [&, r](RenderWindowInfo&) {
+            runtime.waitForUpload(cubeTicket);
 
-            // FRONT BUMPER
-            {
-                glm::mat4 m = glm::translate(busMatrix, glm::vec3(0.0f, 0.35f, 3.15f));
-                drawCube(VAO, m, modelLoc, colorLoc,
-                    glm::vec3(2.45f, 0.25f, 0.20f),
-                    trimColor,
-                    emissiveColorLoc, emissiveStrengthLoc);
-            }
+            glEnable(GL_DEPTH_TEST);
+            r->program = createShader(vertexShaderSource, fragmentShaderSource);
+            glUniformBlockBinding(r->program, glGetUniformBlockIndex(r->program, "ViewBlock"), 0);
+            r->lightLoc = getLightLocations(r->program);
 
-            // HEADLIGHTS (EMISSIVE + also point lights exist)
-            {
-                glm::mat4 m1 = glm::translate(busMatrix, glm::vec3(-0.9f, 0.40f, 3.26f));
-                drawCube(VAO, m1, modelLoc, colorLoc,
-                    glm::vec3(0.25f, 0.15f, 0.08f),
-                    lightYellow,
-                    emissiveColorLoc, emissiveStrengthLoc,
-                    lightYellow, 1.8f); // emissive glow
-
-                glm::mat4 m2 = glm::translate(busMatrix, glm::vec3(0.9f, 0.40f, 3.26f));
-                drawCube(VAO, m2, modelLoc, colorLoc,
-                    glm::vec3(0.25f, 0.15f, 0.08f),
-                    lightYellow,
-                    emissiveColorLoc, emissiveStrengthLoc,
-                    lightYellow, 1.8f);
-            }
+            // VAOs are per context, so each window points its own at the shared cube
+            glGenVertexArrays(1, &r->VAO);
+            glBindVertexArray(r->VAO);
+            setUpCubeAttributes(cubeVBO);
+
+            glGenBuffers(1, &r->instanceVBO);
+            glGenBuffers(1, &r->viewUBO);
+            glBindBuffer(GL_UNIFORM_BUFFER, r->viewUBO);
+            glBufferData(GL_UNIFORM_BUFFER, sizeof(ViewBlock), NULL, GL_STREAM_DRAW);
+        };
 
-            // REAR LIGHTS (EMISSIVE)
+        RenderCallback onFrame = [&, r](RenderWindowInfo& info) {
             {
-                glm::mat4 m1 = glm::translate(busMatrix, glm::vec3(-0.95f, 0.50f, -3.05f));
-                drawCube(VAO, m1, modelLoc, colorLoc,
-                    glm::vec3(0.18f, 0.18f, 0.08f),
-                    redLight,
-                    emissiveColorLoc, emissiveStrengthLoc,
-                    redLight, 1.2f);
-
-                glm::mat4 m2 = glm::translate(busMatrix, glm::vec3(0.95f, 0.50f, -3.05f));
-                drawCube(VAO, m2, modelLoc, colorLoc,
-                    glm::vec3(0.18f, 0.18f, 0.08f),
-                    redLight,
-                    emissiveColorLoc, emissiveStrengthLoc,
-                    redLight, 1.2f);
+                std::lock_guard<std::mutex> lock(snapshotMutex);
+                r->frame = snapshot;
             }
-
-            // DOOR (hinge)
+            if (r->frame.partWorlds.empty() || info.width == 0 || info.height == 0)
+                return;
+
+            glViewport(0, 0, info.width, info.height);
+            glClearColor(0.06f, 0.06f, 0.08f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+            glUseProgram(r->program);
+            setLightUniforms(r->lightLoc, r->frame.lights);
+
+            ViewBlock block = r->frame.views[info.index];
+            block.projection = glm::perspective(glm::radians(45.0f), (float)info.width / (float)info.height, 0.1f, 300.0f);
+            glBindBuffer(GL_UNIFORM_BUFFER, r->viewUBO);
+            glBufferData(GL_UNIFORM_BUFFER, sizeof(ViewBlock), NULL, GL_STREAM_DRAW);
+            glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(ViewBlock), &block);
+            glBindBufferBase(GL_UNIFORM_BUFFER, 0, r->viewUBO);
+
+            // every window sorts front to back for its own view
+            r->queue.clear();
+            for (size_t i = 0; i < busParts.size(); i++)
             {
-                glm::vec3 hinge = glm::vec3(1.24f, 0.65f, 1.7f);
-                glm::mat4 m = busMatrix;
-
-                m = glm::translate(m, hinge);
-                m = glm::rotate(m, glm::radians(doorAngle), glm::vec3(0, 1, 0));
-                m = glm::translate(m, glm::vec3(-0.10f, 0.0f, 0.0f));
-
-                drawCube(VAO, m, modelLoc, colorLoc,
-                    glm::vec3(0.10f, 1.0f, 0.70f),
-                    glm::vec3(0.25f, 0.25f, 0.70f),
-                    emissiveColorLoc, emissiveStrengthLoc);
+                const glm::mat4& model = r->frame.partWorlds[i];
+                float depth = -(block.view * model[3]).z;
+                r->queue.push(r->program, busParts[i].material, r->VAO, depth, 300.0f, &model, 0, 36);
             }
+            r->queue.sort();
+            r->queue.buildInstances(materials);
+            r->queue.uploadInstances(r->instanceVBO);
+            r->queue.submitInstanced(r->instanceVBO, 2);
+        };
 
-            // WHEELS
-            {
-                float wheelRadius = 0.45f;
-                float wheelWidth = 0.22f;
+        RenderCallback onExit = [r](RenderWindowInfo&) {
+            glDeleteVertexArrays(1, &r->VAO);
+            glDeleteBuffers(1, &r->instanceVBO);
+            glDeleteBuffers(1, &r->viewUBO);
+            glDeleteProgram(r->program);
+        };
 
-                glm::vec3 wheelPos[4] = {
-                    glm::vec3(-1.15f, 0.20f,  2.20f),
-                    glm::vec3(1.15f, 0.20f,  2.20f),
-                    glm::vec3(-1.15f, 0.20f, -2.20f),
-                    glm::vec3(1.15f, 0.20f, -2.20f)
-                };
+        windows[vp] = runtime.addWindow(SCR_WIDTH / 2, SCR_HEIGHT / 2, titles[vp], onInit, onFrame, onExit);
+        if (windows[vp] == NULL)
+        {
+            runtime.shutdown();
+            glfwTerminate();
+            return -1;
+        }
+    }
 
-                for (int i = 0; i < 4; i++)
-                {
-                    glm::mat4 w = glm::translate(busMatrix, wheelPos[i]);
-                    drawCube(VAO, w, modelLoc, colorLoc,
-                        glm::vec3(wheelWidth, wheelRadius * 1.2f, wheelRadius * 1.2f),
-                        glm::vec3(0.05f, 0.05f, 0.05f),
-                        emissiveColorLoc, emissiveStrengthLoc);
-
-                    drawWheelFakeCylinder(VAO, w, modelLoc, colorLoc,
-                        emissiveColorLoc, emissiveStrengthLoc,
-                        wheelRadius, wheelWidth,
-                        glm::vec3(0.08f, 0.08f, 0.08f));
-                }
-            }
+    runtime.run([&](double dt) {
+        deltaTime = (float)dt;
 
-            // FAN (inside)
+        // keys go to whichever view window has focus
+        for (int vp = 0; vp < VIEW_COUNT; vp++)
+        {
+            if (glfwGetWindowAttrib(windows[vp], GLFW_FOCUSED))
             {
-                glm::mat4 m = glm::translate(busMatrix, glm::vec3(0.0f, 1.55f, 0.0f));
-                m = glm::rotate(m, glm::radians(fanAngle), glm::vec3(0, 1, 0));
-                drawCube(VAO, m, modelLoc, colorLoc,
-                    glm::vec3(1.0f, 0.05f, 0.12f),
-                    glm::vec3(0.92f, 0.92f, 0.92f),
-                    emissiveColorLoc, emissiveStrengthLoc,
-                    glm::vec3(0.65f, 0.75f, 1.0f), 0.25f);
-
-                glm::mat4 m2 = glm::translate(busMatrix, glm::vec3(0.0f, 1.55f, 0.0f));
-                m2 = glm::rotate(m2, glm::radians(fanAngle + 90.0f), glm::vec3(0, 1, 0));
-                drawCube(VAO, m2, modelLoc, colorLoc,
-                    glm::vec3(1.0f, 0.05f, 0.12f),
-                    glm::vec3(0.92f, 0.92f, 0.92f),
-                    emissiveColorLoc, emissiveStrengthLoc,
-                    glm::vec3(0.65f, 0.75f, 1.0f), 0.25f);
+                processInput(windows[vp]);
+                break;
             }
         }
 
-        glfwSwapBuffers(window);
-        glfwPollEvents();
-    }
+        glm::mat4 busMatrix = updateScene(scene, busNode, doorNode, fanNode);
 
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
-    glDeleteProgram(shaderProgram);
+        std::lock_guard<std::mutex> lock(snapshotMutex);
+        for (int vp = 0; vp < VIEW_COUNT; vp++)
+            computeView(vp, busMatrix, 1.0f, snapshot.views[vp]);
+        snapshot.lights = captureLights(busMatrix);
+        snapshot.partWorlds.resize(busParts.size());
+        for (size_t i = 0; i < busParts.size(); i++)
+            snapshot.partWorlds[i] = scene.world(busParts[i].node);
+    });
 
     glfwTerminate();
     return 0;
@@ -0,0 +1,278 @@
+//
+//  renderQueue.h
+//  3DBus
+//
+//  Collects draws for a frame, sorts them by state and submits them with redundant
+//  state changes skipped. Every draw gets a 64-bit key
+//
+//      63..56 program | 55..40 material | 39..24 VAO | 23..0 depth
+//
+//  so after sorting, draws sharing a program are adjacent, then draws sharing a
+//  material, then a VAO, front to back within each run.
+//
+//  The sorted draws are turned into per-instance data once per frame (buildInstances)
+//  and submitted as one instanced draw per program/VAO run (submitInstanced), which is
+//  what lets the same frame be drawn into several viewports for the cost of a few
+//  calls each.
+//
+
+#ifndef renderQueue_h
+#define renderQueue_h
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtx/matrix_affine.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// the per-instance material of the bus shader
+struct Material
+{
+    glm::vec3 color;
+    glm::vec3 eColor;
+    float eStrength;
+};
+
+// deduplicated list of materials; a draw refers to its material by index
+class MaterialTable {
+public:
+    int add(glm::vec3 color, glm::vec3 eColor = glm::vec3(0), float eStrength = 0.0f)
+    {
+        for (size_t i = 0; i < materials.size(); i++)
+        {
+            const Material& m = materials[i];
+            if (m.color == color && m.eColor == eColor && m.eStrength == eStrength)
+                return (int)i;
+        }
+        Material m;
+        m.color = color;
+        m.eColor = eColor;
+        m.eStrength = eStrength;
+        materials.push_back(m);
+        return (int)materials.size() - 1;
+    }
+
+    const Material& operator[](int i) const
+    {
+        return materials[i];
+    }
+
+private:
+    std::vector<Material> materials;
+};
+
+struct DrawCommand
+{
+    uint64_t key;
+    unsigned int program;
+    unsigned int vao;
+    int material;
+    GLint first;
+    GLsizei count;
+    const glm::mat4* model;
+};
+
+// per-instance attributes, read at instanceLocation .. instanceLocation + 4:
+// the first three rows of the model matrix, color, emissive color with the strength in w.
+// Models are affine, so the packed matrix makes an instance 80 bytes instead of 96
+struct InstanceData
+{
+    glm::mat3x4 model;
+    glm::vec4 color;
+    glm::vec4 emissive;
+};
+
+// a run of sorted draws sharing program, VAO and vertex range, drawn as one instanced call
+struct DrawBatch
+{
+    unsigned int program;
+    unsigned int vao;
+    GLint first;
+    GLsizei count;
+    int firstInstance;
+    int instanceCount;
+};
+
+struct RenderQueueStats
+{
+    int draws;
+    int programBinds;
+    int vaoBinds;
+    // compared with binding the program once and the material and VAO for every draw
+    int bindsSaved;
+};
+
+class RenderQueue {
+public:
+
+    RenderQueueStats stats = {};
+
+    void clear()
+    {
+        commands.clear();
+    }
+
+    // depth is the view space distance of the draw, clamped to [0, maxDepth]
+    void push(unsigned int program, int material, unsigned int vao, float depth, float maxDepth,
+        const glm::mat4* model, GLint first, GLsizei count)
+    {
+        float d = depth / maxDepth;
+        d = d < 0.0f ? 0.0f : (d > 1.0f ? 1.0f : d);
+
+        DrawCommand c;
+        c.key = ((uint64_t)(program & 0xFF) << 56)
+            | ((uint64_t)(material & 0xFFFF) << 40)
+            | ((uint64_t)(vao & 0xFFFF) << 24)
+            | (uint64_t)(d * 0xFFFFFF);
+        c.program = program;
+        c.vao = vao;
+        c.material = material;
+        c.first = first;
+        c.count = count;
+        c.model = model;
+        commands.push_back(c);
+    }
+
+    // least significant digit radix sort on the key, one byte per pass;
+    // passes where every key has the same byte are skipped
+    void sort()
+    {
+        size_t n = commands.size();
+        scratch.resize(n);
+
+        for (int shift = 0; shift < 64; shift += 8)
+        {
+            size_t histogram[256] = {};
+            for (size_t i = 0; i < n; i++)
+                histogram[(commands[i].key >> shift) & 0xFF]++;
+            if (n == 0 || histogram[(commands[0].key >> shift) & 0xFF] == n)
+                continue;
+
+            size_t offset = 0;
+            for (int b = 0; b < 256; b++)
+            {
+                size_t c = histogram[b];
+                histogram[b] = offset;
+                offset += c;
+            }
+            for (size_t i = 0; i < n; i++)
+                scratch[histogram[(commands[i].key >> shift) & 0xFF]++] = commands[i];
+            commands.swap(scratch);
+        }
+    }
+
+    // turns the sorted draws into per-instance data and batches; call once per frame after sort()
+    void buildInstances(const MaterialTable& materials)
+    {
+        instances.resize(commands.size());
+        batches.clear();
+
+        for (size_t i = 0; i < commands.size(); i++)
+        {
+            const DrawCommand& c = commands[i];
+            const Material& m = materials[c.material];
+
+            InstanceData& d = instances[i];
+            d.model = glm::affineFromMat4(*c.model);
+            d.color = glm::vec4(m.color, 1.0f);
+            d.emissive = glm::vec4(m.eColor, m.eStrength);
+
+            if (batches.empty() || batches.back().program != c.program || batches.back().vao != c.vao ||
+                batches.back().first != c.first || batches.back().count != c.count)
+            {
+                DrawBatch b;
+                b.program = c.program;
+                b.vao = c.vao;
+                b.first = c.first;
+                b.count = c.count;
+                b.firstInstance = (int)i;
+                b.instanceCount = 0;
+                batches.push_back(b);
+            }
+            batches.back().instanceCount++;
+        }
+    }
+
+    // streams this frame's instance data into instanceVBO
+    void uploadInstances(unsigned int instanceVBO)
+    {
+        size_t size = instances.size() * sizeof(InstanceData);
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+        if (size > instanceCapacity)
+        {
+            glBufferData(GL_ARRAY_BUFFER, size, instances.data(), GL_STREAM_DRAW);
+            instanceCapacity = size;
+        }
+        else
+        {
+            // orphan the old storage so the upload never waits on last frame's draws
+            glBufferData(GL_ARRAY_BUFFER, instanceCapacity, NULL, GL_STREAM_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, size, instances.data());
+        }
+    }
+
+    // draws every batch; the caller only has to set up per-view state beforehand
+    void submitInstanced(unsigned int instanceVBO, unsigned int instanceLocation)
+    {
+        unsigned int program = 0;
+        int binds = 0;
+
+        for (size_t i = 0; i < batches.size(); i++)
+        {
+            const DrawBatch& b = batches[i];
+            if (i == 0 || b.program != program)
+            {
+                glUseProgram(b.program);
+                program = b.program;
+                stats.programBinds++;
+                binds++;
+            }
+
+            // 3.3 has no base instance, so the attributes are pointed at the batch's first instance
+            glBindVertexArray(b.vao);
+            glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+            size_t base = b.firstInstance * sizeof(InstanceData);
+            for (unsigned int column = 0; column < 3; column++)
+            {
+                glVertexAttribPointer(instanceLocation + column, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData),
+                    (void*)(base + column * sizeof(glm::vec4)));
+                glEnableVertexAttribArray(instanceLocation + column);
+                glVertexAttribDivisor(instanceLocation + column, 1);
+            }
+            glVertexAttribPointer(instanceLocation + 3, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(base + offsetof(InstanceData, color)));
+            glEnableVertexAttribArray(instanceLocation + 3);
+            glVertexAttribDivisor(instanceLocation + 3, 1);
+            glVertexAttribPointer(instanceLocation + 4, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(base + offsetof(InstanceData, emissive)));
+            glEnableVertexAttribArray(instanceLocation + 4);
+            glVertexAttribDivisor(instanceLocation + 4, 1);
+            stats.vaoBinds++;
+            binds++;
+
+            glDrawArraysInstanced(GL_TRIANGLES, b.first, b.count, b.instanceCount);
+        }
+
+        int n = (int)commands.size();
+        stats.draws += n;
+        if (n > 0)
+            stats.bindsSaved += 1 + 2 * n - binds;
+    }
+
+    // returns the counters gathered since the last call and starts over
+    RenderQueueStats takeStats()
+    {
+        RenderQueueStats s = stats;
+        stats = RenderQueueStats();
+        return s;
+    }
+
+private:
+    std::vector<DrawCommand> commands;
+    std::vector<DrawCommand> scratch;
+    std::vector<InstanceData> instances;
+    std::vector<DrawBatch> batches;
+    size_t instanceCapacity = 0;
+};
+
+#endif /* renderQueue_h */
@@ -0,0 +1,323 @@
+//
+//  windowRuntime.h
+//  3DBus
+//
+//  Runs several windows side by side, each rendering on a thread of its own. The
+//  main thread only creates the windows and pumps events. A hidden window carries
+//  an upload context that every window context shares objects with; jobs queued
+//  with upload() run there on a worker thread, and each one is followed by a fence.
+//  Before every frame a render thread makes its GPU wait on the fences it has not
+//  seen yet (glWaitSync, the CPU does not block), so shared buffers, textures and
+//  programs are complete before they are drawn with.
+//
+//  VAOs and framebuffers are never shared between contexts, so create those in the
+//  window's onInit. GLFW only allows most window functions on the main thread, so
+//  the framebuffer size is read there and handed to the render threads.
+//
+
+#ifndef windowRuntime_h
+#define windowRuntime_h
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// what a render callback gets to know about its window; only touched by its render thread
+struct RenderWindowInfo
+{
+    GLFWwindow* window;
+    int index;
+    int width;
+    int height;
+    uint64_t frame;
+};
+
+typedef std::function<void(RenderWindowInfo&)> RenderCallback;
+
+class WindowRuntime {
+public:
+
+    ~WindowRuntime()
+    {
+        shutdown();
+    }
+
+    // creates the upload context; call on the main thread after glfwInit and the
+    // context hints every window should get
+    bool init()
+    {
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        uploadWindow = glfwCreateWindow(1, 1, "", NULL, NULL);
+        glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+        if (uploadWindow == NULL)
+        {
+            std::cout << "WINDOW_RUNTIME::Failed to create upload context" << std::endl;
+            return false;
+        }
+
+        // the entry points are the same for every context of these hints
+        glfwMakeContextCurrent(uploadWindow);
+        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+        {
+            std::cout << "WINDOW_RUNTIME::Failed to init GLAD" << std::endl;
+            return false;
+        }
+        glfwMakeContextCurrent(NULL);
+
+        uploader = std::thread(&WindowRuntime::runUploads, this);
+        return true;
+    }
+
+    // creates a window sharing objects with the upload context; main thread only, before run()
+    GLFWwindow* addWindow(int width, int height, const char* title,
+        RenderCallback onInit, RenderCallback onFrame, RenderCallback onExit = RenderCallback())
+    {
+        GLFWwindow* window = glfwCreateWindow(width, height, title, NULL, uploadWindow);
+        if (window == NULL)
+        {
+            std::cout << "WINDOW_RUNTIME::Failed to create window " << title << std::endl;
+            return NULL;
+        }
+
+        RenderWindow* w = new RenderWindow();
+        w->info.window = window;
+        w->info.index = (int)windows.size();
+        w->info.frame = 0;
+        w->onInit = onInit;
+        w->onFrame = onFrame;
+        w->onExit = onExit;
+        glfwGetFramebufferSize(window, &w->info.width, &w->info.height);
+        w->width = w->info.width;
+        w->height = w->info.height;
+        windows.push_back(w);
+        return window;
+    }
+
+    // queues work for the upload context and returns its ticket; callable from any thread
+    uint64_t upload(std::function<void()> job)
+    {
+        std::lock_guard<std::mutex> lock(uploadMutex);
+        jobs.push_back(job);
+        uploadReady.notify_one();
+        return ++queuedTicket;
+    }
+
+    // blocks until the job of the ticket has run; on a render thread the context's
+    // GPU is also made to wait for it, so the objects can be used right away
+    void waitForUpload(uint64_t ticket)
+    {
+        std::unique_lock<std::mutex> lock(uploadMutex);
+        uploadDone.wait(lock, [&] { return completedTicket >= ticket || !running; });
+        lock.unlock();
+
+        GLFWwindow* current = glfwGetCurrentContext();
+        for (size_t i = 0; i < windows.size(); i++)
+            if (windows[i]->info.window == current)
+                syncUploads(*windows[i]);
+    }
+
+    // starts the render threads and pumps events until every window was asked to
+    // close; tick runs on the main thread at roughly tickRate per second
+    void run(std::function<void(double)> tick = std::function<void(double)>(), double tickRate = 120.0)
+    {
+        for (size_t i = 0; i < windows.size(); i++)
+            windows[i]->thread = std::thread(&WindowRuntime::runWindow, this, windows[i]);
+
+        double last = glfwGetTime();
+        for (;;)
+        {
+            if (tick)
+                glfwWaitEventsTimeout(1.0 / tickRate);
+            else
+                glfwWaitEvents();
+
+            bool open = false;
+            for (size_t i = 0; i < windows.size(); i++)
+            {
+                RenderWindow* w = windows[i];
+                if (glfwWindowShouldClose(w->info.window))
+                {
+                    glfwHideWindow(w->info.window);
+                    continue;
+                }
+                open = true;
+
+                int width, height;
+                glfwGetFramebufferSize(w->info.window, &width, &height);
+                w->width = width;
+                w->height = height;
+            }
+            if (!open)
+                break;
+
+            if (tick)
+            {
+                double now = glfwGetTime();
+                tick(now - last);
+                last = now;
+            }
+        }
+
+        shutdown();
+    }
+
+    // joins every thread and destroys the windows; main thread only, called by run()
+    void shutdown()
+    {
+        {
+            // wakes render threads waiting for an upload as well as the upload thread
+            std::lock_guard<std::mutex> lock(uploadMutex);
+            running = false;
+            uploadReady.notify_one();
+            uploadDone.notify_all();
+        }
+
+        for (size_t i = 0; i < windows.size(); i++)
+        {
+            glfwSetWindowShouldClose(windows[i]->info.window, GLFW_TRUE);
+            if (windows[i]->thread.joinable())
+                windows[i]->thread.join();
+        }
+
+        if (uploader.joinable())
+            uploader.join();
+
+        for (size_t i = 0; i < windows.size(); i++)
+        {
+            glfwDestroyWindow(windows[i]->info.window);
+            delete windows[i];
+        }
+        windows.clear();
+
+        if (uploadWindow != NULL)
+            glfwDestroyWindow(uploadWindow);
+        uploadWindow = NULL;
+    }
+
+private:
+
+    struct RenderWindow {
+        RenderWindowInfo info;
+        RenderCallback onInit, onFrame, onExit;
+        std::thread thread;
+        std::atomic<int> width{ 0 }, height{ 0 };
+        // newest upload this context has waited on
+        uint64_t syncedTicket = 0;
+    };
+
+    struct Fence {
+        uint64_t ticket;
+        GLsync sync;
+    };
+
+    GLFWwindow* uploadWindow = NULL;
+    std::vector<RenderWindow*> windows;
+    std::atomic<bool> running{ true };
+
+    std::thread uploader;
+    std::mutex uploadMutex;
+    std::condition_variable uploadReady, uploadDone;
+    std::deque<std::function<void()> > jobs;
+    uint64_t queuedTicket = 0;
+    uint64_t completedTicket = 0;
+    // fences of finished jobs, oldest first; deleted by the upload thread once signalled
+    std::deque<Fence> fences;
+
+    // makes this context's GPU wait for every upload it has not waited on yet
+    void syncUploads(RenderWindow& w)
+    {
+        std::lock_guard<std::mutex> lock(uploadMutex);
+        for (size_t i = 0; i < fences.size(); i++)
+            if (fences[i].ticket > w.syncedTicket)
+                glWaitSync(fences[i].sync, 0, GL_TIMEOUT_IGNORED);
+        // retired fences had already signalled, so skipping them is fine
+        w.syncedTicket = completedTicket;
+    }
+
+    void runWindow(RenderWindow* w)
+    {
+        glfwMakeContextCurrent(w->info.window);
+        glfwSwapInterval(1);
+
+        syncUploads(*w);
+        if (w->onInit)
+            w->onInit(w->info);
+
+        while (running && !glfwWindowShouldClose(w->info.window))
+        {
+            syncUploads(*w);
+            w->info.width = w->width;
+            w->info.height = w->height;
+            w->onFrame(w->info);
+            glfwSwapBuffers(w->info.window);
+            w->info.frame++;
+        }
+
+        if (w->onExit)
+            w->onExit(w->info);
+        glfwMakeContextCurrent(NULL);
+    }
+
+    // deletes the fences every context can stop waiting on; upload mutex held
+    void retireFences()
+    {
+        while (!fences.empty() && glClientWaitSync(fences.front().sync, 0, 0) != GL_TIMEOUT_EXPIRED)
+        {
+            glDeleteSync(fences.front().sync);
+            fences.pop_front();
+        }
+    }
+
+    void runUploads()
+    {
+        glfwMakeContextCurrent(uploadWindow);
+
+        std::unique_lock<std::mutex> lock(uploadMutex);
+        while (running)
+        {
+            // wake up now and then while fences are pending so they get retired
+            uploadReady.wait_for(lock, std::chrono::milliseconds(10),
+                [&] { return !jobs.empty() || !running; });
+            retireFences();
+
+            while (!jobs.empty())
+            {
+                std::function<void()> job = jobs.front();
+                jobs.pop_front();
+
+                lock.unlock();
+                job();
+                // flush so the fence reaches the GPU before anyone waits on it
+                GLsync sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+                glFlush();
+                lock.lock();
+
+                Fence f;
+                f.ticket = ++completedTicket;
+                f.sync = sync;
+                fences.push_back(f);
+                uploadDone.notify_all();
+            }
+        }
+
+        // Render threads may still be running, but they only touch fences under the
+        // upload mutex, which is held here. Once glFinish returns every fence has
+        // signalled, so retiring them all is safe; jobs still queued are dropped.
+        glFinish();
+        retireFences();
+        lock.unlock();
+        glfwMakeContextCurrent(NULL);
+    }
+};
+
+#endif /* windowRuntime_h */
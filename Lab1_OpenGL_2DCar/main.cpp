@@ -10,6 +10,8 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include "sceneGraph.h"
+
 // 1. HELPER FUNCTION: READ FILE
 std::string readFile(const char* filePath) {
     std::ifstream file(filePath);
@@ -157,6 +159,40 @@ int main()
     float propellerAngle = 0.0f;
     float flapAngle = 0.0f;
 
+    // PLANE HIERARCHY
+    // parts hang off the plane node and are built once; the loop only updates
+    // the plane, flap and propeller transforms
+    SceneGraph scene;
+    int planeNode = scene.addNode(-1);
+
+    int bodyNode = scene.addNode(planeNode, glm::scale(glm::mat4(1.0f), glm::vec3(1.5f, 0.3f, 1.0f)));
+
+    glm::mat4 windowPart = glm::translate(glm::mat4(1.0f), glm::vec3(0.2f, 0.15f, 0.0f));
+    windowPart = glm::scale(windowPart, glm::vec3(0.4f, 0.2f, 1.0f));
+    int windowNode = scene.addNode(planeNode, windowPart);
+
+    glm::mat4 tail = glm::translate(glm::mat4(1.0f), glm::vec3(-0.70f, 0.25f, 0.0f));
+    tail = glm::rotate(tail, glm::radians(90.0f), glm::vec3(0, 0, 1));
+    tail = glm::scale(tail, glm::vec3(0.4f, 0.5f, 1.0f));
+    int tailNode = scene.addNode(planeNode, tail);
+
+    glm::mat4 nose = glm::translate(glm::mat4(1.0f), glm::vec3(0.9f, 0.0f, 0.0f));
+    nose = glm::scale(nose, glm::vec3(0.3f, 0.3f, 1.0f));
+    int noseNode = scene.addNode(planeNode, nose);
+
+    glm::mat4 wing = glm::translate(glm::mat4(1.0f), glm::vec3(0.1f, -0.05f, 0.0f));
+    wing = glm::scale(wing, glm::vec3(0.6f, 0.15f, 1.0f));
+    int wingNode = scene.addNode(planeNode, wing);
+
+    // flap and propeller rotate about a pivot node; the part itself is a static child
+    int flapPivot = scene.addNode(planeNode);
+    glm::mat4 flap = glm::translate(glm::mat4(1.0f), glm::vec3(-0.1f, 0.0f, 0.0f));
+    flap = glm::scale(flap, glm::vec3(0.2f, 0.1f, 1.0f));
+    int flapNode = scene.addNode(flapPivot, flap);
+
+    int propPivot = scene.addNode(planeNode);
+    int propNode = scene.addNode(propPivot, glm::scale(glm::mat4(1.0f), glm::vec3(0.05f, 1.1f, 1.0f)));
+
     //glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 
     while (!glfwWindowShouldClose(window))
@@ -195,62 +231,57 @@ int main()
         globalPlane = glm::translate(globalPlane, glm::vec3(planeX, planeY, 0.0f));
         globalPlane = glm::rotate(globalPlane, planeAngle, glm::vec3(0, 0, 1));
         globalPlane = glm::scale(globalPlane, glm::vec3(planeScale, planeScale, 1.0f));
+        scene.setLocal(planeNode, globalPlane);
+
+        glm::mat4 flapPivotMatrix = glm::translate(glm::mat4(1.0f), glm::vec3(-0.2f, -0.05f, 0.0f));
+        flapPivotMatrix = glm::rotate(flapPivotMatrix, flapAngle, glm::vec3(0, 0, 1));
+        scene.setLocal(flapPivot, flapPivotMatrix);
+
+        glm::mat4 propPivotMatrix = glm::translate(glm::mat4(1.0f), glm::vec3(1.05f, 0.0f, 0.0f));
+        propPivotMatrix = glm::rotate(propPivotMatrix, glm::radians(propellerAngle), glm::vec3(0, 0, 1));
+        scene.setLocal(propPivot, propPivotMatrix);
+
+        // recomputes only the parts below a node that changed
+        scene.update();
 
         // 1. FUSELAGE
-        glm::mat4 body = glm::scale(globalPlane, glm::vec3(1.5f, 0.3f, 1.0f));
-        shader.setMat4("uTransform", glm::value_ptr(body));
+        shader.setMat4("uTransform", glm::value_ptr(scene.world(bodyNode)));
         shader.setVec3("uColor", 0.8f, 0.2f, 0.2f);
         glBindVertexArray(rectVAO);
         glDrawArrays(GL_TRIANGLES, 0, 6);
 
         // 2. COCKPIT
-        glm::mat4 windowPart = glm::translate(globalPlane, glm::vec3(0.2f, 0.15f, 0.0f));
-        windowPart = glm::scale(windowPart, glm::vec3(0.4f, 0.2f, 1.0f));
-        shader.setMat4("uTransform", glm::value_ptr(windowPart));
+        shader.setMat4("uTransform", glm::value_ptr(scene.world(windowNode)));
         shader.setVec3("uColor", 0.6f, 0.8f, 1.0f);
         glBindVertexArray(rectVAO);
         glDrawArrays(GL_TRIANGLES, 0, 6);
 
         // 3. TAIL
-        glm::mat4 tail = glm::translate(globalPlane, glm::vec3(-0.70f, 0.25f, 0.0f));
-        tail = glm::rotate(tail, glm::radians(90.0f), glm::vec3(0, 0, 1));
-        tail = glm::scale(tail, glm::vec3(0.4f, 0.5f, 1.0f));
-        shader.setMat4("uTransform", glm::value_ptr(tail));
+        shader.setMat4("uTransform", glm::value_ptr(scene.world(tailNode)));
         shader.setVec3("uColor", 0.6f, 0.6f, 0.6f);
         glBindVertexArray(triVAO);
         glDrawArrays(GL_TRIANGLES, 0, 3);
 
         // 4. NOSE
-        glm::mat4 nose = glm::translate(globalPlane, glm::vec3(0.9f, 0.0f, 0.0f));
-        nose = glm::scale(nose, glm::vec3(0.3f, 0.3f, 1.0f));
-        shader.setMat4("uTransform", glm::value_ptr(nose));
+        shader.setMat4("uTransform", glm::value_ptr(scene.world(noseNode)));
         shader.setVec3("uColor", 0.9f, 0.9f, 0.9f);
         glBindVertexArray(triVAO);
         glDrawArrays(GL_TRIANGLES, 0, 3);
 
         // 5. WING
-        glm::mat4 wing = glm::translate(globalPlane, glm::vec3(0.1f, -0.05f, 0.0f));
-        wing = glm::scale(wing, glm::vec3(0.6f, 0.15f, 1.0f));
-        shader.setMat4("uTransform", glm::value_ptr(wing));
+        shader.setMat4("uTransform", glm::value_ptr(scene.world(wingNode)));
         shader.setVec3("uColor", 0.5f, 0.5f, 0.5f);
         glBindVertexArray(rectVAO);
         glDrawArrays(GL_TRIANGLES, 0, 6);
 
         // 6. FLAP
-        glm::mat4 flap = glm::translate(globalPlane, glm::vec3(-0.2f, -0.05f, 0.0f));
-        flap = glm::rotate(flap, flapAngle, glm::vec3(0, 0, 1));
-        flap = glm::translate(flap, glm::vec3(-0.1f, 0.0f, 0.0f));
-        flap = glm::scale(flap, glm::vec3(0.2f, 0.1f, 1.0f));
-        shader.setMat4("uTransform", glm::value_ptr(flap));
+        shader.setMat4("uTransform", glm::value_ptr(scene.world(flapNode)));
         shader.setVec3("uColor", 0.2f, 0.8f, 0.2f);
         glBindVertexArray(rectVAO);
         glDrawArrays(GL_TRIANGLES, 0, 6);
 
         // 7. PROPELLER
-        glm::mat4 prop = glm::translate(globalPlane, glm::vec3(1.05f, 0.0f, 0.0f));
-        prop = glm::rotate(prop, glm::radians(propellerAngle), glm::vec3(0, 0, 1));
-        prop = glm::scale(prop, glm::vec3(0.05f, 1.1f, 1.0f));
-        shader.setMat4("uTransform", glm::value_ptr(prop));
+        shader.setMat4("uTransform", glm::value_ptr(scene.world(propNode)));
         shader.setVec3("uColor", 0.1f, 0.1f, 0.1f);
         glBindVertexArray(rectVAO);
         glDrawArrays(GL_TRIANGLES, 0, 6);
@@ -0,0 +1,105 @@
+//
+//  sceneGraph.h
+//  Lab1_OpenGL_2DCar
+//
+//  Flat, index based transform hierarchy. Nodes live in parallel arrays and a node
+//  is always stored after its parent, so one forward pass over the arrays visits
+//  every parent before its children. Local transforms are cached; world matrices are
+//  only recomputed for nodes whose local transform changed and for everything below
+//  them. A frame where nothing moved costs a single comparison in update().
+//
+
+#ifndef sceneGraph_h
+#define sceneGraph_h
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cassert>
+#include <vector>
+
+class SceneGraph {
+public:
+
+    // adds a node below parent (-1 for a root) and returns its index;
+    // the parent must already exist, which keeps parents ahead of their children
+    int addNode(int parent, const glm::mat4& localTransform = glm::mat4(1.0f))
+    {
+        assert(parent < (int)parents.size());
+
+        int node = (int)parents.size();
+        parents.push_back(parent);
+        locals.push_back(localTransform);
+        worlds.push_back(localTransform);
+        dirty.push_back(1);
+        if (firstDirty > node)
+            firstDirty = node;
+        return node;
+    }
+
+    // replaces a node's local transform; setting the same matrix again is free
+    void setLocal(int node, const glm::mat4& localTransform)
+    {
+        if (locals[node] == localTransform)
+            return;
+        locals[node] = localTransform;
+        dirty[node] = 1;
+        if (firstDirty > node)
+            firstDirty = node;
+    }
+
+    const glm::mat4& local(int node) const
+    {
+        return locals[node];
+    }
+
+    // valid after update()
+    const glm::mat4& world(int node) const
+    {
+        return worlds[node];
+    }
+
+    // contiguous world matrices in node order, ready to be copied into an instance buffer
+    const glm::mat4* worldMatrices() const
+    {
+        return worlds.data();
+    }
+
+    int size() const
+    {
+        return (int)parents.size();
+    }
+
+    // recomputes world matrices of changed subtrees; returns false if nothing changed
+    bool update()
+    {
+        int count = (int)parents.size();
+        if (firstDirty >= count)
+            return false;
+
+        for (int i = firstDirty; i < count; i++)
+        {
+            int p = parents[i];
+            if (p >= 0 && dirty[p])
+                dirty[i] = 1;
+            if (!dirty[i])
+                continue;
+            worlds[i] = p >= 0 ? worlds[p] * locals[i] : locals[i];
+        }
+        // parents were consumed above, so the flags can only be cleared once the pass is done
+        for (int i = firstDirty; i < count; i++)
+            dirty[i] = 0;
+
+        firstDirty = count;
+        return true;
+    }
+
+private:
+    std::vector<int> parents;
+    std::vector<glm::mat4> locals;
+    std::vector<glm::mat4> worlds;
+    std::vector<unsigned char> dirty;
+    int firstDirty = 0;
+};
+
+#endif /* sceneGraph_h */
@@ -16,6 +16,7 @@
 
 #include "shader.h"
 #include "basic_camera.h"
+#include "sceneGraph.h"
 
 #include <iostream>
 
@@ -28,8 +29,8 @@ void printMatrix4(glm::mat4 matrix, string name);
 void processInput(GLFWwindow* window);
 
 // draw object functions
-void drawAxes(Shader shaderProgram, unsigned int VAO, glm::mat4 parentTrans);
-void drawCube(Shader shaderProgram, unsigned int VAO, glm::mat4 parentTrans, float posX = 0.0, float posY = 0.0, float posz = 0.0, float rotX = 0.0, float rotY = 0.0, float rotZ = 0.0, float scX = 1.0, float scY = 1.0, float scZ = 1.0);
+void drawCube(Shader shaderProgram, unsigned int VAO, const glm::mat4& model);
+glm::mat4 cubeTransform(float posX = 0.0, float posY = 0.0, float posz = 0.0, float rotX = 0.0, float rotY = 0.0, float rotZ = 0.0, float scX = 1.0, float scY = 1.0, float scZ = 1.0);
 
 // settings
 const unsigned int SCR_WIDTH = 800;
@@ -275,6 +276,13 @@ int main()
     //ourShader.use();
     //constantShader.use();
 
+    // scene: the axes never move, so their matrices are computed once here
+    SceneGraph scene;
+    int cube1Node = scene.addNode(-1);
+    int cube2Node = scene.addNode(-1);
+    int xAxisNode = scene.addNode(-1, cubeTransform(0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 100.0, 0.1, 0.1));
+    int yAxisNode = scene.addNode(-1, cubeTransform(0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 100.0, 0.1));
+
     // render loop
     // -----------
     while (!glfwWindowShouldClose(window))
@@ -313,11 +321,17 @@ int main()
         constantShader.setMat4("view", view);
 
         // Modelling Transformation
-        glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
-        drawCube(ourShader, VAO, identityMatrix, translate_X+cube1_X, translate_Y, translate_Z, rotateAngle_X, rotateAngle_Y, rotateAngle_Z, scale_X, scale_Y, scale_Z);
-        drawCube(ourShader, VAO2, identityMatrix, translate_X+cube2_X, translate_Y, translate_Z, rotateAngle_X, rotateAngle_Y, rotateAngle_Z, scale_X, scale_Y, scale_Z);
+        // (setting an unchanged transform leaves the node clean)
+        scene.setLocal(cube1Node, cubeTransform(translate_X+cube1_X, translate_Y, translate_Z, rotateAngle_X, rotateAngle_Y, rotateAngle_Z, scale_X, scale_Y, scale_Z));
+        scene.setLocal(cube2Node, cubeTransform(translate_X+cube2_X, translate_Y, translate_Z, rotateAngle_X, rotateAngle_Y, rotateAngle_Z, scale_X, scale_Y, scale_Z));
+        scene.update();
+
+        drawCube(ourShader, VAO, scene.world(cube1Node));
+        drawCube(ourShader, VAO2, scene.world(cube2Node));
 
-        drawAxes(constantShader, VAO, identityMatrix);
+        // axes
+        drawCube(constantShader, VAO, scene.world(xAxisNode));
+        drawCube(constantShader, VAO, scene.world(yAxisNode));
         // lookat cube
         //drawCube(ourShader, VAO, identityMatrix, lookAtX, lookAtY, lookAtZ, 0.0, 0.0, 0.0, 0.25, 0.25, 0.25);
 
@@ -522,30 +536,27 @@ void scroll_callback(GLFWwindow* window, double xoffset, double yoffset)
     basic_camera.ProcessMouseScroll(static_cast<float>(yoffset));
 }
 
-void drawCube(Shader shaderProgram, unsigned int VAO, glm::mat4 parentTrans, float posX, float posY, float posZ, float rotX, float rotY, float rotZ, float scX, float scY, float scZ)
+// local transform of a cube: translate -> rotateX -> rotateY -> rotateZ -> scale, centred on its origin
+glm::mat4 cubeTransform(float posX, float posY, float posZ, float rotX, float rotY, float rotZ, float scX, float scY, float scZ)
 {
-    shaderProgram.use();
-
-    glm::mat4 translateMatrix, rotateXMatrix, rotateYMatrix, rotateZMatrix, scaleMatrix, model, modelCentered;
-    translateMatrix = glm::translate(parentTrans, glm::vec3(posX, posY, posZ));
+    glm::mat4 translateMatrix, rotateXMatrix, rotateYMatrix, rotateZMatrix, model;
+    translateMatrix = glm::translate(glm::mat4(1.0f), glm::vec3(posX, posY, posZ));
     rotateXMatrix = glm::rotate(translateMatrix, glm::radians(rotX), glm::vec3(1.0f, 0.0f, 0.0f));
     rotateYMatrix = glm::rotate(rotateXMatrix, glm::radians(rotY), glm::vec3(0.0f, 1.0f, 0.0f));
     rotateZMatrix = glm::rotate(rotateYMatrix, glm::radians(rotZ), glm::vec3(0.0f, 0.0f, 1.0f));
     model = glm::scale(rotateZMatrix, glm::vec3(scX, scY, scZ));
-    modelCentered = glm::translate(model, glm::vec3(-0.25, -0.25, -0.25));
+    return glm::translate(model, glm::vec3(-0.25, -0.25, -0.25));
+}
 
-    shaderProgram.setMat4("model", modelCentered);
+void drawCube(Shader shaderProgram, unsigned int VAO, const glm::mat4& model)
+{
+    shaderProgram.use();
+    shaderProgram.setMat4("model", model);
 
     glBindVertexArray(VAO);
     glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 }
 
-void drawAxes(Shader shaderProgram, unsigned int VAO, glm::mat4 parentTrans)
-{
-    drawCube(shaderProgram, VAO, parentTrans, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 100.0, 0.1, 0.1);
-    drawCube(shaderProgram, VAO, parentTrans, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 100.0, 0.1);
-}
-
 void printMatrix4(glm::mat4 matrix, string name = "")
 {
     if (!printMatNow) return;
@@ -17,6 +17,65 @@
 
 using namespace std;
 
+// vertex data shared by every instance: position (3), normal (3), texture coordinate (2)
+static const float cube_vertices[] = {
+    // positions      // normals         // texture
+    // back
+    -0.5f, -0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 0.75, 0,
+    0.5f, -0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 0.5, 0,
+    0.5f, 0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 0.5, 1,
+    -0.5f, 0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 0.75, 1,
+
+    // right
+    0.5f, -0.5f, -0.5f, 1.0f, 0.0f, 0.0f, 0.5, 0,
+    0.5f, 0.5f, -0.5f, 1.0f, 0.0f, 0.0f, 0.5, 1,
+    0.5f, -0.5f, 0.5f, 1.0f, 0.0f, 0.0f, 0.25, 0,
+    0.5f, 0.5f, 0.5f, 1.0f, 0.0f, 0.0f, 0.25, 1,
+
+    // front
+    -0.5f, -0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 0, 0,
+    0.5f, -0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 0.25, 0,
+    0.5f, 0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 0.25, 0.25,
+    -0.5f, 0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 0, 0.25,
+
+    // left
+    -0.5f, -0.5f, 0.5f, -1.0f, 0.0f, 0.0f, 1, 0,
+    -0.5f, 0.5f, 0.5f, -1.0f, 0.0f, 0.0f, 1, 1,
+    -0.5f, 0.5f, -0.5f, -1.0f, 0.0f, 0.0f, 0.75, 1,
+    -0.5f, -0.5f, -0.5f, -1.0f, 0.0f, 0.0f, 0.75, 0,
+
+    // top
+    0.5f, 0.5f, 0.5f, 0.0f, 1.0f, 0.0f, 1, 0,
+    0.5f, 0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 1, 2,
+    -0.5f, 0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 0, 2,
+    -0.5f, 0.5f, 0.5f, 0.0f, 1.0f, 0.0f, 0, 0,
+
+    // bottom
+    -0.5f, -0.5f, -0.5f, 0.0f, -1.0f, 0.0f, 0, 0,
+    0.5f, -0.5f, -0.5f, 0.0f, -1.0f, 0.0f, 1, 0,
+    0.5f, -0.5f, 0.5f, 0.0f, -1.0f, 0.0f, 1, 1,
+    -0.5f, -0.5f, 0.5f, 0.0f, -1.0f, 0.0f, 0, 1
+};
+static const unsigned int cube_indices[] = {
+    0, 3, 2,
+    2, 1, 0,
+
+    4, 5, 7,
+    7, 6, 4,
+
+    8, 9, 10,
+    10, 11, 8,
+
+    12, 13, 14,
+    14, 15, 12,
+
+    16, 17, 18,
+    18, 19, 16,
+
+    20, 21, 22,
+    22, 23, 20
+};
+
 class Cube {
 public:
 
@@ -123,63 +182,6 @@ private:
         // set up vertex data (and buffer(s)) and configure vertex attributes
         // ------------------------------------------------------------------
 
-        float cube_vertices[] = {
-            // positions      // normals         // texture
-            // back
-            -0.5f, -0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 0.75, 0,
-            0.5f, -0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 0.5, 0,
-            0.5f, 0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 0.5, 1,
-            -0.5f, 0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 0.75, 1,
-
-            // right
-            0.5f, -0.5f, -0.5f, 1.0f, 0.0f, 0.0f, 0.5, 0,
-            0.5f, 0.5f, -0.5f, 1.0f, 0.0f, 0.0f, 0.5, 1,
-            0.5f, -0.5f, 0.5f, 1.0f, 0.0f, 0.0f, 0.25, 0,
-            0.5f, 0.5f, 0.5f, 1.0f, 0.0f, 0.0f, 0.25, 1,
-
-            // front
-            -0.5f, -0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 0, 0,
-            0.5f, -0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 0.25, 0,
-            0.5f, 0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 0.25, 0.25,
-            -0.5f, 0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 0, 0.25,
-
-            // left
-            -0.5f, -0.5f, 0.5f, -1.0f, 0.0f, 0.0f, 1, 0,
-            -0.5f, 0.5f, 0.5f, -1.0f, 0.0f, 0.0f, 1, 1,
-            -0.5f, 0.5f, -0.5f, -1.0f, 0.0f, 0.0f, 0.75, 1,
-            -0.5f, -0.5f, -0.5f, -1.0f, 0.0f, 0.0f, 0.75, 0,
-
-            // top
-            0.5f, 0.5f, 0.5f, 0.0f, 1.0f, 0.0f, 1, 0,
-            0.5f, 0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 1, 2,
-            -0.5f, 0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 0, 2,
-            -0.5f, 0.5f, 0.5f, 0.0f, 1.0f, 0.0f, 0, 0,
-
-            // bottom
-            -0.5f, -0.5f, -0.5f, 0.0f, -1.0f, 0.0f, 0, 0,
-            0.5f, -0.5f, -0.5f, 0.0f, -1.0f, 0.0f, 1, 0,
-            0.5f, -0.5f, 0.5f, 0.0f, -1.0f, 0.0f, 1, 1,
-            -0.5f, -0.5f, 0.5f, 0.0f, -1.0f, 0.0f, 0, 1
-        };
-        unsigned int cube_indices[] = {
-            0, 3, 2,
-            2, 1, 0,
-
-            4, 5, 7,
-            7, 6, 4,
-
-            8, 9, 10,
-            10, 11, 8,
-
-            12, 13, 14,
-            14, 15, 12,
-
-            16, 17, 18,
-            18, 19, 16,
-
-            20, 21, 22,
-            22, 23, 20
-        };
 
         glGenVertexArrays(1, &cubeVAO);
         glGenVertexArrays(1, &lightCubeVAO);
@@ -17,6 +17,93 @@
 
 using namespace std;
 
+// vertex data shared by every instance: position (3), normal (3), texture coordinate (2)
+static const float hexa_vertices[] = {
+    // positions      // normals         // texture
+    // back
+    -0.5f, -0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 1, 0,
+    0.5f, -0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 0, 0,
+    0.5f, 0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 0, 1,
+    -0.5f, 0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 1, 1,
+
+    // front
+    -0.5f, -0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 0, 0,
+    0.5f, -0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 1, 0,
+    0.5f, 0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 1, 1,
+    -0.5f, 0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 0, 1,
+
+    // front-right
+    0.5f, -0.5f, 0.5f, 1.0f, 0.0f, 1.0f, 0, 0,
+    1.0f, -0.5f, 0.0f, 1.0f, 0.0f, 1.0f, 1, 0,
+    1.0f, 0.5f, 0.0f, 1.0f, 0.0f, 1.0f, 1, 1,
+    0.5f, 0.5f, 0.5f, 1.0f, 0.0f, 1.0f, 0, 1,
+
+    // back-right
+    0.5f, -0.5f, -0.5f, 1.0f, 0.0f, -1.0f, 1, 0,
+    1.0f, -0.5f, 0.0f, 1.0f, 0.0f, -1.0f, 0, 0,
+    1.0f, 0.5f, 0.0f, 1.0f, 0.0f, -1.0f, 0, 1,
+    0.5f, 0.5f, -0.5f, 1.0f, 0.0f, -1.0f, 1, 1,
+
+    // front-left
+    -0.5f, -0.5f, 0.5f, -1.0f, 0.0f, 1.0f, 1, 0,
+    -1.0f, -0.5f, 0.0f, -1.0f, 0.0f, 1.0f, 0, 0,
+    -1.0f, 0.5f, 0.0f, -1.0f, 0.0f, 1.0f, 0, 1,
+    -0.5f, 0.5f, 0.5f, -1.0f, 0.0f, 1.0f, 1, 1,
+
+    // back-left
+    -0.5f, -0.5f, -0.5f, -1.0f, 0.0f, -1.0f, 0, 0,
+    -1.0f, -0.5f, 0.0f, -1.0f, 0.0f, -1.0f, 1, 0,
+    -1.0f, 0.5f, 0.0f, -1.0f, 0.0f, -1.0f, 1, 1,
+    -0.5f, 0.5f, -0.5f, -1.0f, 0.0f, -1.0f, 0, 1,
+
+    // top
+    0.5f, 0.5f, 0.5f, 0.0f, 1.0f, 0.0f, 0.75, 0,
+    0.5f, 0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 0.75, 1,
+    -0.5f, 0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 0.25, 1,
+    -0.5f, 0.5f, 0.5f, 0.0f, 1.0f, 0.0f, 0.25, 0,
+
+    -1.0f, 0.5f, 0.0f, 0.0f, 1.0f, 0.0f, 0, 0.5,
+    1.0f, 0.5f, 0.0f, 0.0f, 1.0f, 0.0f, 1, 0.5,
+
+    // bottom
+    -0.5f, -0.5f, -0.5f, 0.0f, -1.0f, 0.0f, 0.25, 0,
+    0.5f, -0.5f, -0.5f, 0.0f, -1.0f, 0.0f, 0.75, 0,
+    0.5f, -0.5f, 0.5f, 0.0f, -1.0f, 0.0f, 0.75, 1,
+    -0.5f, -0.5f, 0.5f, 0.0f, -1.0f, 0.0f, 0.25, 1,
+
+    -1.0f, -0.5f, 0.0f, 0.0f, -1.0f, 0.0f, 0, 0.5,
+    1.0f, -0.5f, 0.0f, 0.0f, -1.0f, 0.0f, 1, 0.5
+};
+static const unsigned int hexa_indices[] = {
+    0, 3, 2,
+    2, 1, 0,
+
+    4, 5, 6,
+    4, 6, 7,
+
+    8, 9, 10,
+    10, 11, 8,
+
+    12, 13, 14,
+    14, 15, 12,
+
+    16, 17, 18,
+    18, 19, 16,
+
+    20, 21, 22,
+    22, 23, 20,
+
+    24, 25, 26,
+    26, 27, 24,
+    27, 26, 28,
+    25, 24, 29,
+
+    30, 31, 32,
+    32, 33, 30,
+    30, 33, 34,
+    32, 31, 35
+};
+
 class Hexagon {
 public:
 
@@ -107,91 +194,6 @@ private:
         // set up vertex data (and buffer(s)) and configure vertex attributes
         // ------------------------------------------------------------------
 
-        float hexa_vertices[] = {
-            // positions      // normals         // texture
-            // back
-            -0.5f, -0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 1, 0,
-            0.5f, -0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 0, 0,
-            0.5f, 0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 0, 1,
-            -0.5f, 0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 1, 1,
-
-            // front
-            -0.5f, -0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 0, 0,
-            0.5f, -0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 1, 0,
-            0.5f, 0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 1, 1,
-            -0.5f, 0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 0, 1,
-
-            // front-right
-            0.5f, -0.5f, 0.5f, 1.0f, 0.0f, 1.0f, 0, 0,
-            1.0f, -0.5f, 0.0f, 1.0f, 0.0f, 1.0f, 1, 0,
-            1.0f, 0.5f, 0.0f, 1.0f, 0.0f, 1.0f, 1, 1,
-            0.5f, 0.5f, 0.5f, 1.0f, 0.0f, 1.0f, 0, 1,
-
-            // back-right
-            0.5f, -0.5f, -0.5f, 1.0f, 0.0f, -1.0f, 1, 0,
-            1.0f, -0.5f, 0.0f, 1.0f, 0.0f, -1.0f, 0, 0,
-            1.0f, 0.5f, 0.0f, 1.0f, 0.0f, -1.0f, 0, 1,
-            0.5f, 0.5f, -0.5f, 1.0f, 0.0f, -1.0f, 1, 1,
-
-            // front-left
-            -0.5f, -0.5f, 0.5f, -1.0f, 0.0f, 1.0f, 1, 0,
-            -1.0f, -0.5f, 0.0f, -1.0f, 0.0f, 1.0f, 0, 0,
-            -1.0f, 0.5f, 0.0f, -1.0f, 0.0f, 1.0f, 0, 1,
-            -0.5f, 0.5f, 0.5f, -1.0f, 0.0f, 1.0f, 1, 1,
-
-            // back-left
-            -0.5f, -0.5f, -0.5f, -1.0f, 0.0f, -1.0f, 0, 0,
-            -1.0f, -0.5f, 0.0f, -1.0f, 0.0f, -1.0f, 1, 0,
-            -1.0f, 0.5f, 0.0f, -1.0f, 0.0f, -1.0f, 1, 1,
-            -0.5f, 0.5f, -0.5f, -1.0f, 0.0f, -1.0f, 0, 1,
-
-            // top
-            0.5f, 0.5f, 0.5f, 0.0f, 1.0f, 0.0f, 0.75, 0,
-            0.5f, 0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 0.75, 1,
-            -0.5f, 0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 0.25, 1,
-            -0.5f, 0.5f, 0.5f, 0.0f, 1.0f, 0.0f, 0.25, 0,
-
-            -1.0f, 0.5f, 0.0f, 0.0f, 1.0f, 0.0f, 0, 0.5,
-            1.0f, 0.5f, 0.0f, 0.0f, 1.0f, 0.0f, 1, 0.5,
-
-            // bottom
-            -0.5f, -0.5f, -0.5f, 0.0f, -1.0f, 0.0f, 0.25, 0,
-            0.5f, -0.5f, -0.5f, 0.0f, -1.0f, 0.0f, 0.75, 0,
-            0.5f, -0.5f, 0.5f, 0.0f, -1.0f, 0.0f, 0.75, 1,
-            -0.5f, -0.5f, 0.5f, 0.0f, -1.0f, 0.0f, 0.25, 1,
-
-            -1.0f, -0.5f, 0.0f, 0.0f, -1.0f, 0.0f, 0, 0.5,
-            1.0f, -0.5f, 0.0f, 0.0f, -1.0f, 0.0f, 1, 0.5
-        };
-        unsigned int hexa_indices[] = {
-            0, 3, 2,
-            2, 1, 0,
-
-            4, 5, 6,
-            4, 6, 7,
-
-            8, 9, 10,
-            10, 11, 8,
-
-            12, 13, 14,
-            14, 15, 12,
-
-            16, 17, 18,
-            18, 19, 16,
-
-            20, 21, 22,
-            22, 23, 20,
-
-            24, 25, 26,
-            26, 27, 24,
-            27, 26, 28,
-            25, 24, 29,
-
-            30, 31, 32,
-            32, 33, 30,
-            30, 33, 34,
-            32, 31, 35
-        };
 
         glGenVertexArrays(1, &hexaVAO);
         glGenVertexArrays(1, &lightHexagonVAO);
@@ -0,0 +1,373 @@
+//
+//  hotReload.h
+//  test
+//
+//  Watches shader and texture files and rebuilds them while the app is running.
+//  Files are rebuilt on a worker thread that owns a hidden context shared with the
+//  main window; the new GL object is handed back to the render thread, which swaps
+//  it in once its fence has signalled. A shader that fails to compile or link is
+//  thrown away and the old program stays in use.
+//
+
+#ifndef hotReload_h
+#define hotReload_h
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "shader.h"
+#include "stb_image.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/stat.h>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// defined in main.cpp
+unsigned int loadTexture(char const* path, GLenum textureWrappingModeS, GLenum textureWrappingModeT, GLenum textureFilteringModeMin, GLenum textureFilteringModeMax);
+
+class HotReloader {
+public:
+
+    // must be called on the main thread after the window's context has been created
+    HotReloader(GLFWwindow* mainWindow)
+    {
+        // hidden window whose only job is to carry a context sharing objects with the main one;
+        // the context hints set up for the main window are still in effect
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        uploadWindow = glfwCreateWindow(1, 1, "", NULL, mainWindow);
+        glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+        if (uploadWindow == NULL)
+        {
+            std::cout << "HOT_RELOAD::Failed to create upload context, hot reload disabled" << std::endl;
+            return;
+        }
+
+#ifdef __linux__
+        inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+    }
+
+    ~HotReloader()
+    {
+        stop();
+    }
+
+    // stops watching and releases the upload context; call before glfwTerminate
+    void stop()
+    {
+        if (uploadWindow == NULL)
+            return;
+
+        running = false;
+        if (worker.joinable())
+            worker.join();
+
+        for (size_t i = 0; i < finished.size(); i++)
+        {
+            glDeleteSync(finished[i].fence);
+            if (finished[i].texture)
+                glDeleteTextures(1, &finished[i].object);
+            else
+                glDeleteProgram(finished[i].object);
+        }
+        finished.clear();
+
+#ifdef __linux__
+        if (inotifyFd >= 0)
+            close(inotifyFd);
+        inotifyFd = -1;
+#endif
+        glfwDestroyWindow(uploadWindow);
+        uploadWindow = NULL;
+    }
+
+    // rebuild the shader's program whenever one of its source files changes
+    void watchShader(Shader& shader)
+    {
+        Entry entry;
+        entry.shader = &shader;
+        entry.paths.push_back(shader.vertexPath);
+        entry.paths.push_back(shader.fragmentPath);
+        if (!shader.geometryPath.empty())
+            entry.paths.push_back(shader.geometryPath);
+        addEntry(entry);
+    }
+
+    // reload the image whenever it changes; every texture name in users is repointed
+    // to the new texture, so pass the members of every object sharing it
+    void watchTexture(const char* path, std::vector<unsigned int*> users, GLenum textureWrappingModeS, GLenum textureWrappingModeT, GLenum textureFilteringModeMin, GLenum textureFilteringModeMax)
+    {
+        Entry entry;
+        entry.paths.push_back(path);
+        entry.textureUsers = users;
+        entry.wrapS = textureWrappingModeS;
+        entry.wrapT = textureWrappingModeT;
+        entry.minFilter = textureFilteringModeMin;
+        entry.magFilter = textureFilteringModeMax;
+        addEntry(entry);
+    }
+
+    // call once per frame on the render thread; swaps in anything the worker finished
+    void update()
+    {
+        if (uploadWindow == NULL)
+            return;
+        if (!worker.joinable())
+            worker = std::thread(&HotReloader::run, this);
+
+        std::lock_guard<std::mutex> lock(finishedMutex);
+        for (size_t i = 0; i < finished.size();)
+        {
+            Result& r = finished[i];
+            // not there yet, look again next frame instead of stalling this one
+            if (glClientWaitSync(r.fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+            {
+                i++;
+                continue;
+            }
+            glDeleteSync(r.fence);
+
+            Entry& entry = entries[r.entry];
+            if (r.texture)
+            {
+                unsigned int old = *entry.textureUsers[0];
+                for (size_t u = 0; u < entry.textureUsers.size(); u++)
+                    *entry.textureUsers[u] = r.object;
+                glDeleteTextures(1, &old);
+                std::cout << "HOT_RELOAD::Reloaded texture " << entry.paths[0] << std::endl;
+            }
+            else
+            {
+                glDeleteProgram(entry.shader->ID);
+                entry.shader->ID = r.object;
+                std::cout << "HOT_RELOAD::Reloaded shader " << entry.paths[0] << std::endl;
+            }
+            finished.erase(finished.begin() + i);
+        }
+    }
+
+private:
+
+    struct Entry {
+        std::vector<std::string> paths;
+        std::vector<time_t> modified;
+
+        // exactly one of these is set
+        Shader* shader = nullptr;
+        std::vector<unsigned int*> textureUsers;
+
+        GLenum wrapS, wrapT, minFilter, magFilter;
+    };
+
+    struct Result {
+        size_t entry;
+        unsigned int object;
+        bool texture;
+        GLsync fence;
+    };
+
+    GLFWwindow* uploadWindow = NULL;
+    std::thread worker;
+    std::atomic<bool> running{ true };
+
+    // entries are only added before the worker starts, so the worker reads them unlocked
+    std::vector<Entry> entries;
+
+    std::mutex finishedMutex;
+    std::vector<Result> finished;
+
+#ifdef __linux__
+    int inotifyFd = -1;
+    std::map<int, std::string> watchedDirectories;
+#endif
+
+    void addEntry(Entry& entry)
+    {
+        if (worker.joinable())
+        {
+            std::cout << "HOT_RELOAD::Files must be watched before the first update()" << std::endl;
+            return;
+        }
+
+        for (size_t i = 0; i < entry.paths.size(); i++)
+        {
+            entry.modified.push_back(modificationTime(entry.paths[i]));
+#ifdef __linux__
+            watchDirectory(directoryOf(entry.paths[i]));
+#endif
+        }
+        entries.push_back(entry);
+    }
+
+    static time_t modificationTime(const std::string& path)
+    {
+        struct stat info;
+        if (stat(path.c_str(), &info) != 0)
+            return 0;
+        return info.st_mtime;
+    }
+
+    static std::string directoryOf(const std::string& path)
+    {
+        size_t slash = path.find_last_of("/\\");
+        return slash == std::string::npos ? std::string(".") : path.substr(0, slash);
+    }
+
+    static std::string fileNameOf(const std::string& path)
+    {
+        size_t slash = path.find_last_of("/\\");
+        return slash == std::string::npos ? path : path.substr(slash + 1);
+    }
+
+#ifdef __linux__
+    void watchDirectory(const std::string& directory)
+    {
+        if (inotifyFd < 0)
+            return;
+        for (std::map<int, std::string>::iterator it = watchedDirectories.begin(); it != watchedDirectories.end(); ++it)
+            if (it->second == directory)
+                return;
+
+        // editors usually save by writing a temporary file and renaming it over the
+        // original, so watch the directory rather than the file itself
+        int wd = inotify_add_watch(inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+        if (wd >= 0)
+            watchedDirectories[wd] = directory;
+    }
+
+    // blocks for up to timeoutMs waiting for file events, marks the matching entries dirty
+    void waitForChanges(std::vector<bool>& dirty, int timeoutMs)
+    {
+        pollfd pfd = { inotifyFd, POLLIN, 0 };
+        if (poll(&pfd, 1, timeoutMs) <= 0)
+            return;
+
+        alignas(inotify_event) char buffer[4096];
+        ssize_t length;
+        while ((length = read(inotifyFd, buffer, sizeof(buffer))) > 0)
+        {
+            for (char* p = buffer; p < buffer + length;)
+            {
+                const inotify_event* event = (const inotify_event*)p;
+                p += sizeof(inotify_event) + event->len;
+                if (event->len == 0)
+                    continue;
+
+                const std::string& directory = watchedDirectories[event->wd];
+                for (size_t e = 0; e < entries.size(); e++)
+                    for (size_t i = 0; i < entries[e].paths.size(); i++)
+                        if (directoryOf(entries[e].paths[i]) == directory && fileNameOf(entries[e].paths[i]) == event->name)
+                            dirty[e] = true;
+            }
+        }
+    }
+#endif
+
+    // portable fallback: compare modification times
+    void pollForChanges(std::vector<bool>& dirty)
+    {
+        for (size_t e = 0; e < entries.size(); e++)
+        {
+            for (size_t i = 0; i < entries[e].paths.size(); i++)
+            {
+                time_t t = modificationTime(entries[e].paths[i]);
+                if (t != 0 && t != entries[e].modified[i])
+                {
+                    entries[e].modified[i] = t;
+                    dirty[e] = true;
+                }
+            }
+        }
+    }
+
+    void run()
+    {
+        glfwMakeContextCurrent(uploadWindow);
+
+        std::vector<bool> dirty(entries.size(), false);
+        while (running)
+        {
+            bool any = false;
+#ifdef __linux__
+            if (inotifyFd >= 0)
+            {
+                waitForChanges(dirty, 100);
+                // an editor save is a burst of events; let it settle before rebuilding
+                for (size_t e = 0; e < dirty.size(); e++)
+                    any = any || dirty[e];
+                if (any)
+                    waitForChanges(dirty, 50);
+            }
+            else
+#endif
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(250));
+                pollForChanges(dirty);
+            }
+
+            for (size_t e = 0; e < entries.size(); e++)
+            {
+                if (!dirty[e])
+                    continue;
+                dirty[e] = false;
+                rebuild(e);
+            }
+        }
+
+        glfwMakeContextCurrent(NULL);
+    }
+
+    void rebuild(size_t e)
+    {
+        Entry& entry = entries[e];
+        Result r;
+        r.entry = e;
+        r.texture = entry.shader == nullptr;
+
+        if (r.texture)
+        {
+            int width, height, nrComponents;
+            if (!stbi_info(entry.paths[0].c_str(), &width, &height, &nrComponents))
+            {
+                std::cout << "HOT_RELOAD::Cannot decode " << entry.paths[0] << ", keeping the old texture" << std::endl;
+                return;
+            }
+            r.object = loadTexture(entry.paths[0].c_str(), entry.wrapS, entry.wrapT, entry.minFilter, entry.magFilter);
+        }
+        else
+        {
+            bool ok;
+            Shader& s = *entry.shader;
+            r.object = Shader::build(s.vertexPath.c_str(), s.fragmentPath.c_str(),
+                s.geometryPath.empty() ? nullptr : s.geometryPath.c_str(), &ok);
+            if (!ok)
+            {
+                glDeleteProgram(r.object);
+                std::cout << "HOT_RELOAD::Keeping the old program for " << entry.paths[0] << std::endl;
+                return;
+            }
+        }
+
+        // the render thread waits on this before using the object; flush so the
+        // fence actually reaches the GPU from this context
+        r.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+
+        std::lock_guard<std::mutex> lock(finishedMutex);
+        finished.push_back(r);
+    }
+};
+
+#endif /* hotReload_h */
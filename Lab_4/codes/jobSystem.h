@@ -0,0 +1,415 @@
+//
+//  jobSystem.h
+//  test
+//
+//  A small work-stealing job system running one task graph per frame. A task is
+//  added together with the tasks it depends on and becomes runnable once those are
+//  done. A parallel-for task is cut into chunks that every thread can pick up, and
+//  only counts as done when its last chunk is.
+//
+//  Every thread owns a deque of jobs: it pushes and pops at the back, so it keeps
+//  working on what it just made runnable, and threads that run dry steal from the
+//  front of the others. The thread calling run() works along and is thread 0.
+//
+//  Tasks added with addOnCaller() never leave the thread calling run(). That is
+//  where GL submission goes; no other task may touch the context. A timing hook
+//  gets the start, end and busy time of every task as it finishes.
+//
+
+#ifndef jobSystem_h
+#define jobSystem_h
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+class JobSystem {
+public:
+
+    typedef int TaskId;
+    typedef std::function<void()> TaskFunc;
+    typedef std::function<void(size_t begin, size_t end)> RangeFunc;
+
+    // times are in seconds since run() was called
+    struct TaskTiming
+    {
+        const char* name;
+        double start;
+        double end;
+        // summed over every thread that ran a chunk of the task
+        double busy;
+        // the thread that finished the task, 0 being the caller of run()
+        int thread;
+    };
+
+    // called on whichever thread finished the task, so it has to be thread-safe
+    typedef std::function<void(const TaskTiming&)> TimingHook;
+
+    // workers < 0 starts one worker less than there are cores, leaving one for the caller
+    explicit JobSystem(int workers = -1)
+    {
+        if (workers < 0)
+            workers = std::max(1, (int)std::thread::hardware_concurrency()) - 1;
+
+        for (int i = 0; i <= workers; i++)
+            queues.push_back(std::unique_ptr<WorkQueue>(new WorkQueue()));
+        for (int i = 1; i <= workers; i++)
+            threads.push_back(std::thread(&JobSystem::runWorker, this, i));
+    }
+
+    ~JobSystem()
+    {
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            quit = true;
+        }
+        wake.notify_all();
+        for (size_t i = 0; i < threads.size(); i++)
+            threads[i].join();
+    }
+
+    // workers plus the thread calling run()
+    int threadCount() const
+    {
+        return (int)queues.size();
+    }
+
+    void setTimingHook(TimingHook hook)
+    {
+        timingHook = hook;
+    }
+
+    // adds a task to the graph of the next run(); dependencies must already be added
+    TaskId add(const char* name, TaskFunc fn, std::initializer_list<TaskId> dependencies = {})
+    {
+        Task& task = newTask(name, dependencies);
+        task.fn = fn;
+        return task.id;
+    }
+
+    // calls fn on consecutive ranges of at most grain items covering [0, count)
+    TaskId addParallelFor(const char* name, size_t count, size_t grain, RangeFunc fn,
+        std::initializer_list<TaskId> dependencies = {})
+    {
+        Task& task = newTask(name, dependencies);
+        task.range = fn;
+        task.count = count;
+        task.grain = std::max<size_t>(grain, 1);
+        task.chunks = std::max<int>(1, (int)((count + task.grain - 1) / task.grain));
+        return task.id;
+    }
+
+    // a task that only ever runs on the thread calling run(), the context thread
+    TaskId addOnCaller(const char* name, TaskFunc fn, std::initializer_list<TaskId> dependencies = {})
+    {
+        Task& task = newTask(name, dependencies);
+        task.fn = fn;
+        task.onCaller = true;
+        return task.id;
+    }
+
+    // runs every task added since the last run and returns once all are done
+    void run()
+    {
+        frameStart = Clock::now();
+        remaining = taskCount;
+
+        for (int i = 0; i < taskCount; i++)
+            if (tasks[i]->dependencies == 0)
+                schedule(*tasks[i], 0);
+
+        while (remaining > 0)
+        {
+            Job job;
+            if (popCaller(job) || pop(0, job))
+                execute(job, 0);
+            else
+                std::this_thread::yield();
+        }
+
+        taskCount = 0;
+    }
+
+private:
+
+    typedef std::chrono::steady_clock Clock;
+
+    struct Task
+    {
+        TaskId id;
+        const char* name;
+        TaskFunc fn;
+        RangeFunc range;
+        size_t count, grain;
+        int chunks;
+        bool onCaller;
+        int dependencies;
+        std::vector<TaskId> successors;
+
+        std::atomic<int> waiting;
+        std::atomic<int> chunksLeft;
+        std::atomic<int64_t> startNs;
+        std::atomic<int64_t> busyNs;
+    };
+
+    struct Job
+    {
+        Task* task;
+        int chunk;
+    };
+
+    struct WorkQueue
+    {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    // tasks are reused from frame to frame, so building the graph rarely allocates
+    std::vector<std::unique_ptr<Task> > tasks;
+    int taskCount = 0;
+    std::atomic<int> remaining{ 0 };
+    Clock::time_point frameStart;
+
+    std::vector<std::unique_ptr<WorkQueue> > queues;
+    std::mutex callerMutex;
+    std::deque<Job> callerJobs;
+    std::vector<std::thread> threads;
+
+    // stealable jobs in all queues, which is what sleeping workers wait for
+    std::atomic<int> queued{ 0 };
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    bool quit = false;
+
+    TimingHook timingHook;
+
+    Task& newTask(const char* name, std::initializer_list<TaskId> dependencies)
+    {
+        if (taskCount == (int)tasks.size())
+            tasks.push_back(std::unique_ptr<Task>(new Task()));
+
+        Task& task = *tasks[taskCount];
+        task.id = taskCount++;
+        task.name = name;
+        task.fn = TaskFunc();
+        task.range = RangeFunc();
+        task.count = 0;
+        task.grain = 1;
+        task.chunks = 1;
+        task.onCaller = false;
+        task.dependencies = (int)dependencies.size();
+        task.successors.clear();
+
+        for (TaskId d : dependencies)
+        {
+            assert(d >= 0 && d < task.id);
+            tasks[d]->successors.push_back(task.id);
+        }
+
+        task.waiting = task.dependencies;
+        task.chunksLeft = task.chunks;
+        task.startNs = INT64_MAX;
+        task.busyNs = 0;
+        return task;
+    }
+
+    int64_t nowNs() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - frameStart).count();
+    }
+
+    // queues every chunk of a task that just became runnable on the given thread
+    void schedule(Task& task, int thread)
+    {
+        task.chunksLeft = task.chunks;
+
+        if (task.onCaller)
+        {
+            std::lock_guard<std::mutex> lock(callerMutex);
+            callerJobs.push_back(Job{ &task, 0 });
+            return;
+        }
+
+        {
+            WorkQueue& q = *queues[thread];
+            std::lock_guard<std::mutex> lock(q.mutex);
+            for (int c = 0; c < task.chunks; c++)
+                q.jobs.push_back(Job{ &task, c });
+        }
+
+        queued += task.chunks;
+        // taking the lock keeps a worker from missing the wakeup between its check and its wait
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+        }
+        if (task.chunks > 1)
+            wake.notify_all();
+        else
+            wake.notify_one();
+    }
+
+    bool popCaller(Job& job)
+    {
+        std::lock_guard<std::mutex> lock(callerMutex);
+        if (callerJobs.empty())
+            return false;
+        job = callerJobs.front();
+        callerJobs.pop_front();
+        return true;
+    }
+
+    // own queue first, newest job first; then the oldest job of another thread
+    bool pop(int thread, Job& job)
+    {
+        int n = (int)queues.size();
+        for (int i = 0; i < n; i++)
+        {
+            WorkQueue& q = *queues[(thread + i) % n];
+            std::lock_guard<std::mutex> lock(q.mutex);
+            if (q.jobs.empty())
+                continue;
+
+            if (i == 0)
+            {
+                job = q.jobs.back();
+                q.jobs.pop_back();
+            }
+            else
+            {
+                job = q.jobs.front();
+                q.jobs.pop_front();
+            }
+            queued--;
+            return true;
+        }
+        return false;
+    }
+
+    void execute(const Job& job, int thread)
+    {
+        Task& task = *job.task;
+        int64_t start = nowNs();
+
+        if (task.range)
+        {
+            size_t begin = (size_t)job.chunk * task.grain;
+            size_t end = std::min(begin + task.grain, task.count);
+            if (begin < end)
+                task.range(begin, end);
+        }
+        else if (task.fn)
+            task.fn();
+
+        int64_t end = nowNs();
+        task.busyNs += end - start;
+        int64_t first = task.startNs;
+        while (start < first && !task.startNs.compare_exchange_weak(first, start))
+            ;
+
+        if (--task.chunksLeft == 0)
+            finish(task, thread, end);
+    }
+
+    void finish(Task& task, int thread, int64_t end)
+    {
+        if (timingHook)
+        {
+            TaskTiming t;
+            t.name = task.name;
+            t.start = task.startNs * 1e-9;
+            t.end = end * 1e-9;
+            t.busy = task.busyNs * 1e-9;
+            t.thread = thread;
+            timingHook(t);
+        }
+
+        for (size_t i = 0; i < task.successors.size(); i++)
+        {
+            Task& next = *tasks[task.successors[i]];
+            if (--next.waiting == 0)
+                schedule(next, thread);
+        }
+
+        // last, since run() may return and reset the graph right after
+        remaining--;
+    }
+
+    void runWorker(int thread)
+    {
+        for (;;)
+        {
+            Job job;
+            if (pop(thread, job))
+            {
+                execute(job, thread);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wake.wait(lock, [&] { return queued > 0 || quit; });
+            if (quit)
+                return;
+        }
+    }
+};
+
+// averages task timings by name over a number of frames; record() may be called
+// from any thread, so it can be the timing hook directly
+class TaskProfile {
+public:
+
+    void record(const JobSystem::TaskTiming& t)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        Entry& e = entries[t.name];
+        e.wall += t.end - t.start;
+        e.busy += t.busy;
+    }
+
+    // prints the per frame average of everything recorded since the last report
+    void report(std::ostream& out, int frames)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (frames <= 0)
+            return;
+
+        std::ios::fmtflags flags = out.flags();
+        out << std::fixed << std::setprecision(3);
+        for (std::map<std::string, Entry>::const_iterator it = entries.begin(); it != entries.end(); ++it)
+        {
+            out << "  task " << std::left << std::setw(12) << it->first << std::right
+                << it->second.wall * 1e3 / frames << " ms, "
+                << it->second.busy * 1e3 / frames << " ms busy\n";
+        }
+        out.flags(flags);
+        entries.clear();
+    }
+
+private:
+
+    struct Entry
+    {
+        double wall = 0.0;
+        double busy = 0.0;
+    };
+
+    std::mutex mutex;
+    std::map<std::string, Entry> entries;
+};
+
+#endif /* jobSystem_h */
@@ -19,6 +19,10 @@
 #include "hexagon.h"
 #include "pyramid.h"
 #include "stb_image.h"
+#include "hotReload.h"
+#include "staticBatch.h"
+#include "jobSystem.h"
+#include "meshFile.h"
 
 #include <iostream>
 
@@ -121,13 +125,15 @@ bool spotLightOn = true;
 bool ambientToggle = true;
 bool diffuseToggle = true;
 bool specularToggle = true;
+bool sceneryOn = false;
+bool taskTimingsOn = false;
 
 
 // timing
 float deltaTime = 0.0f;    // time between current frame and last frame
 float lastFrame = 0.0f;
 
-int main()
+int main(int argc, char** argv)
 {
     // glfw: initialize and configure
     // ------------------------------
@@ -175,6 +181,7 @@ int main()
     
     Shader lightingShaderWithTexture("vertexShaderForPhongShadingWithTexture.vs", "fragmentShaderForPhongShadingWithTexture.fs");
     Shader ourShader("vertexShader.vs", "fragmentShader.fs");
+    Shader lightingShaderWithTextureInstanced("vertexShaderForPhongShadingWithTextureInstanced.vs", "fragmentShaderForPhongShadingWithTexture.fs");
 
     //string laughEmoPath = "emoji.png";
     string laughEmoPath = "color.jpg";
@@ -185,11 +192,55 @@ int main()
 	Hexagon hex = Hexagon(laughEmoji);
 	Cube cube = Cube(laughEmoji);
 
+    // a mesh converted with meshConvert replaces the hexagon when given on the command line
+    MeshFile asset = MeshFile(laughEmoji);
+    bool assetLoaded = argc > 1 && asset.load(argv[1]);
+    if (assetLoaded)
+        std::cout << "Mesh " << argv[1] << ": " << asset.lodCount() << " LODs, " << asset.meshlets.size() << " meshlets" << std::endl;
+
+    // static scenery: a 40 x 40 floor of mixed primitives, drawn in a single call
+    StaticBatch scenery = StaticBatch(laughEmoji);
+    for (int i = 0; i < 40; i++)
+    {
+        for (int j = 0; j < 40; j++)
+        {
+            glm::mat4 tile = glm::translate(glm::mat4(1.0f), glm::vec3(-10.0f + i * 0.5f, -1.5f, -12.0f + j * 0.5f));
+            tile = glm::scale(tile, glm::vec3(0.2f));
+            scenery.add((StaticMesh)((i + j) % STATIC_MESH_COUNT), tile);
+        }
+    }
+    scenery.build();
+    std::cout << "Static scenery (key 2): " << (scenery.usesMultiDrawIndirect() ? "multi-draw indirect" : "instanced fallback") << std::endl;
+
+    // rebuild shaders and textures when they are edited on disk
+    HotReloader hotReload(window);
+    hotReload.watchShader(lightingShaderWithTexture);
+    hotReload.watchShader(ourShader);
+    hotReload.watchShader(lightingShaderWithTextureInstanced);
+    hotReload.watchTexture(laughEmoPath.c_str(), { &laughEmoji, &pyra.textureMap, &hex.textureMap, &cube.textureMap, &scenery.textureMap },
+        GL_REPEAT, GL_REPEAT, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR);
+
     //Sphere sphere = Sphere();
 
     //glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 
 
+    // the lamps are the same cube every frame, only the model matrix differs
+    Cube lightCube = Cube(glm::vec3(0.8f, 0.8f, 0.8f));
+
+    // matrices and scenery culling are computed as a task graph on the job system;
+    // everything touching GL runs in the submit task on this thread
+    JobSystem jobs;
+    TaskProfile profile;
+    jobs.setTimingHook([&profile](const JobSystem::TaskTiming& t) { profile.record(t); });
+    std::cout << "Job system: " << jobs.threadCount() << " threads, task timings (key 3)" << std::endl;
+    float timingsTimer = 0.0f;
+    int timingsFrames = 0;
+
+    glm::mat4 projection, view, model;
+    glm::mat4 lampModels[4];
+    int assetLod = 0;
+
     // render loop
     // -----------
     while (!glfwWindowShouldClose(window))
@@ -204,64 +255,129 @@ int main()
         // -----
         processInput(window);
 
-        // render
-        // ------
-        glClearColor(0.5f, 0.5f, 0.5f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-        // be sure to activate shader when setting uniforms/drawing objects
-        lightingShaderWithTexture.use();
-        lightingShaderWithTexture.setVec3("viewPos", basic_camera.eye);
-
-        // pass projection matrix to shader (note that in this case it could change every frame)
-        glm::mat4 projection = glm::perspective(glm::radians(basic_camera.Zoom), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 100.0f);
-        //glm::mat4 projection = glm::ortho(-2.0f, +2.0f, -1.5f, +1.5f, 0.1f, 100.0f);
-        lightingShaderWithTexture.setMat4("projection", projection);
-
-        // camera/view transformation
-        glm::mat4 view = basic_camera.createViewMatrix();
-        //glm::mat4 view = basic_camera.createViewMatrix();
-        lightingShaderWithTexture.setMat4("view", view);
-
-        // Modelling Transformation
-        glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
-        glm::mat4 translateMatrix, rotateXMatrix, rotateYMatrix, rotateZMatrix, model;
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(translate_X, translate_Y, translate_Z));
-        rotateXMatrix = glm::rotate(translateMatrix, glm::radians(rotateAngle_X), glm::vec3(1.0f, 0.0f, 0.0f));
-        rotateYMatrix = glm::rotate(rotateXMatrix, glm::radians(rotateAngle_Y), glm::vec3(0.0f, 1.0f, 0.0f));
-        rotateZMatrix = glm::rotate(rotateYMatrix, glm::radians(rotateAngle_Z), glm::vec3(0.0f, 0.0f, 1.0f));
-        model = glm::scale(rotateZMatrix, glm::vec3(scale_X, scale_Y, scale_Z));
-
-        lightingShaderWithTexture.use();
-        // point light 1
-        pointlight1.setUpPointLight(lightingShaderWithTexture);
-        // point light 2
-        pointlight2.setUpPointLight(lightingShaderWithTexture);
-        // point light 3
-        pointlight3.setUpPointLight(lightingShaderWithTexture);
-        // point light 4
-        pointlight4.setUpPointLight(lightingShaderWithTexture);
-
-        glm::mat4 modelMatrixForContainer = glm::mat4(1.0f);
-        modelMatrixForContainer = glm::translate(modelMatrixForContainer, glm::vec3(-0.0f, -0.4f, -2.8f));
-
-        //pyra.draw(lightingShaderWithTexture, modelMatrixForContainer * model);
-        hex.draw(lightingShaderWithTexture, modelMatrixForContainer * model);
-		//cube.draw(lightingShaderWithTexture, modelMatrixForContainer* model);
-
-        // also draw the lamp object(s)
-        ourShader.use();
-        ourShader.setMat4("projection", projection);
-        ourShader.setMat4("view", view);
-
-        // we now draw as many light bulbs as we have point lights.
-        for (unsigned int i = 0; i < 4; i++)
+        // swap in any shader or texture rebuilt since the last frame
+        hotReload.update();
+
+        JobSystem::TaskId camera = jobs.add("camera", [&] {
+            // pass projection matrix to shader (note that in this case it could change every frame)
+            projection = glm::perspective(glm::radians(basic_camera.Zoom), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 100.0f);
+            //glm::mat4 projection = glm::ortho(-2.0f, +2.0f, -1.5f, +1.5f, 0.1f, 100.0f);
+
+            // camera/view transformation
+            view = basic_camera.createViewMatrix();
+        });
+
+        JobSystem::TaskId transforms = jobs.add("model", [&] {
+            // Modelling Transformation
+            glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
+            glm::mat4 translateMatrix, rotateXMatrix, rotateYMatrix, rotateZMatrix;
+            translateMatrix = glm::translate(identityMatrix, glm::vec3(translate_X, translate_Y, translate_Z));
+            rotateXMatrix = glm::rotate(translateMatrix, glm::radians(rotateAngle_X), glm::vec3(1.0f, 0.0f, 0.0f));
+            rotateYMatrix = glm::rotate(rotateXMatrix, glm::radians(rotateAngle_Y), glm::vec3(0.0f, 1.0f, 0.0f));
+            rotateZMatrix = glm::rotate(rotateYMatrix, glm::radians(rotateAngle_Z), glm::vec3(0.0f, 0.0f, 1.0f));
+            model = glm::scale(rotateZMatrix, glm::vec3(scale_X, scale_Y, scale_Z));
+
+            glm::mat4 modelMatrixForContainer = glm::mat4(1.0f);
+            modelMatrixForContainer = glm::translate(modelMatrixForContainer, glm::vec3(-0.0f, -0.4f, -2.8f));
+            model = modelMatrixForContainer * model;
+
+            // the coarsest LOD whose error stays under a pixel at the asset's distance
+            if (assetLoaded)
+            {
+                float distance = glm::length(glm::vec3(model * glm::vec4(asset.boundsCenter, 1.0f)) - basic_camera.eye);
+                float pixel = distance * 2.0f * tan(glm::radians(basic_camera.Zoom) * 0.5f) / SCR_HEIGHT;
+                float scale = std::max(glm::length(glm::vec3(model[0])), std::max(glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2]))));
+                assetLod = asset.selectLod(pixel / std::max(scale, 1e-6f));
+            }
+        });
+
+        JobSystem::TaskId lamps = jobs.add("lamps", [&] {
+            for (unsigned int i = 0; i < 4; i++)
+            {
+                lampModels[i] = glm::translate(glm::mat4(1.0f), pointLightPositions[i]);
+                lampModels[i] = glm::scale(lampModels[i], glm::vec3(0.2f)); // Make it a smaller cube
+            }
+        });
+
+        // the scenery is culled in parallel, then every mesh packs its visible instances;
+        // with the scenery off both tasks are empty
+        JobSystem::TaskId cullSetup = jobs.add("cull setup", [&] {
+            if (sceneryOn)
+                scenery.setCullMatrix(projection * view);
+        }, { camera });
+        JobSystem::TaskId culled = jobs.addParallelFor("cull", sceneryOn ? scenery.objectCount() : 0, 256,
+            [&](size_t begin, size_t end) { scenery.cull(begin, end); }, { cullSetup });
+        JobSystem::TaskId packed = jobs.addParallelFor("compact", sceneryOn ? STATIC_MESH_COUNT : 0, 1,
+            [&](size_t begin, size_t end) {
+                for (size_t m = begin; m < end; m++)
+                    scenery.compact((StaticMesh)m);
+            }, { culled });
+
+        jobs.addOnCaller("submit", [&] {
+            // render
+            // ------
+            glClearColor(0.5f, 0.5f, 0.5f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+            // be sure to activate shader when setting uniforms/drawing objects
+            lightingShaderWithTexture.use();
+            lightingShaderWithTexture.setVec3("viewPos", basic_camera.eye);
+            lightingShaderWithTexture.setMat4("projection", projection);
+            lightingShaderWithTexture.setMat4("view", view);
+
+            // point light 1
+            pointlight1.setUpPointLight(lightingShaderWithTexture);
+            // point light 2
+            pointlight2.setUpPointLight(lightingShaderWithTexture);
+            // point light 3
+            pointlight3.setUpPointLight(lightingShaderWithTexture);
+            // point light 4
+            pointlight4.setUpPointLight(lightingShaderWithTexture);
+
+            //pyra.draw(lightingShaderWithTexture, model);
+            if (assetLoaded)
+                asset.draw(lightingShaderWithTexture, model, assetLod);
+            else
+                hex.draw(lightingShaderWithTexture, model);
+            //cube.draw(lightingShaderWithTexture, model);
+
+            if (sceneryOn)
+            {
+                scenery.uploadVisible();
+                lightingShaderWithTextureInstanced.use();
+                lightingShaderWithTextureInstanced.setVec3("viewPos", basic_camera.eye);
+                lightingShaderWithTextureInstanced.setMat4("projection", projection);
+                lightingShaderWithTextureInstanced.setMat4("view", view);
+                pointlight1.setUpPointLight(lightingShaderWithTextureInstanced);
+                pointlight2.setUpPointLight(lightingShaderWithTextureInstanced);
+                pointlight3.setUpPointLight(lightingShaderWithTextureInstanced);
+                pointlight4.setUpPointLight(lightingShaderWithTextureInstanced);
+                scenery.draw(lightingShaderWithTextureInstanced);
+            }
+
+            // also draw the lamp object(s)
+            ourShader.use();
+            ourShader.setMat4("projection", projection);
+            ourShader.setMat4("view", view);
+
+            // we now draw as many light bulbs as we have point lights.
+            for (unsigned int i = 0; i < 4; i++)
+                lightCube.drawColor(ourShader, lampModels[i]);
+        }, { transforms, lamps, packed });
+
+        jobs.run();
+
+        if (taskTimingsOn)
         {
-            Cube lightCube = Cube(glm::vec3(0.8f, 0.8f, 0.8f));
-            model = glm::mat4(1.0f);
-            model = glm::translate(model, pointLightPositions[i]);
-            model = glm::scale(model, glm::vec3(0.2f)); // Make it a smaller cube
-            lightCube.drawColor(ourShader, model);
+            timingsTimer += deltaTime;
+            timingsFrames++;
+            if (timingsTimer >= 1.0f)
+            {
+                std::cout << "tasks per frame:\n";
+                profile.report(std::cout, timingsFrames);
+                timingsTimer = 0.0f;
+                timingsFrames = 0;
+            }
         }
 
         // glfw: swap buffers and poll IO events (keys pressed/released, mouse moved etc.)
@@ -274,6 +390,8 @@ int main()
     // ------------------------------------------------------------------------
 
 
+    hotReload.stop();
+
     // glfw: terminate, clearing all previously allocated GLFW resources.
     // ------------------------------------------------------------------
     glfwTerminate();
@@ -421,6 +539,14 @@ void key_callback(GLFWwindow* window, int key, int scancode, int action, int mod
             pointLightOn = !pointLightOn;
         }
     }
+    if (key == GLFW_KEY_2 && action == GLFW_PRESS)
+    {
+        sceneryOn = !sceneryOn;
+    }
+    if (key == GLFW_KEY_3 && action == GLFW_PRESS)
+    {
+        taskTimingsOn = !taskTimingsOn;
+    }
 
 }
 
@@ -0,0 +1,626 @@
+//
+//  meshConvert.cpp
+//  test
+//
+//  Offline converter from OBJ or glTF 2.0 (.gltf with .bin or data URIs, .glb) to
+//  the binary mesh format of meshFormat.h. It is a separate program and needs no GL:
+//
+//    g++ -O2 -std=c++11 meshConvert.cpp -I<glm include dir> -o meshConvert
+//    meshConvert model.obj model.mesh [lods]
+//
+//  Every triangle primitive of the source ends up in one mesh. glTF node
+//  transforms are not applied, the primitives are taken in mesh space. Missing
+//  normals are computed by averaging face normals; missing texture coordinates are 0.
+//
+
+#include "meshFormat.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+static bool readFile(const string& path, vector<unsigned char>& data)
+{
+    ifstream in(path.c_str(), ios::binary);
+    if (!in)
+        return false;
+    data.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+    return true;
+}
+
+static string directoryOf(const string& path)
+{
+    size_t slash = path.find_last_of("/\\");
+    return slash == string::npos ? string() : path.substr(0, slash + 1);
+}
+
+// smooth normals for vertices that came without one
+static void computeMissingNormals(vector<SourceVertex>& vertices, const vector<uint32_t>& indices, const vector<bool>& hasNormal)
+{
+    for (size_t t = 0; t + 2 < indices.size(); t += 3)
+    {
+        SourceVertex& a = vertices[indices[t]];
+        SourceVertex& b = vertices[indices[t + 1]];
+        SourceVertex& c = vertices[indices[t + 2]];
+        // not normalized, so bigger faces weigh more
+        glm::vec3 n = glm::cross(b.position - a.position, c.position - a.position);
+        for (int k = 0; k < 3; k++)
+            if (!hasNormal[indices[t + k]])
+                vertices[indices[t + k]].normal += n;
+    }
+}
+
+// OBJ
+// ---
+
+// resolves a 1-based or negative (relative) OBJ index; -1 if absent or out of range
+static int objIndex(const string& s, size_t count)
+{
+    if (s.empty())
+        return -1;
+    long i = strtol(s.c_str(), NULL, 10);
+    if (i < 0)
+        i += (long)count;
+    else
+        i -= 1;
+    return i >= 0 && i < (long)count ? (int)i : -1;
+}
+
+struct ObjCorner
+{
+    int position, texCoord, normal;
+
+    ObjCorner(int p, int t, int n) : position(p), texCoord(t), normal(n) {}
+
+    bool operator<(const ObjCorner& o) const
+    {
+        if (position != o.position) return position < o.position;
+        if (texCoord != o.texCoord) return texCoord < o.texCoord;
+        return normal < o.normal;
+    }
+};
+
+static bool loadObj(const string& path, vector<SourceVertex>& vertices, vector<uint32_t>& indices)
+{
+    ifstream in(path.c_str());
+    if (!in)
+        return false;
+
+    vector<glm::vec3> positions, normals;
+    vector<glm::vec2> texCoords;
+    vector<bool> hasNormal;
+    // one output vertex per distinct position/texcoord/normal triple
+    map<ObjCorner, uint32_t> unique;
+
+    string line;
+    while (getline(in, line))
+    {
+        istringstream s(line);
+        string tag;
+        s >> tag;
+
+        if (tag == "v")
+        {
+            glm::vec3 p;
+            s >> p.x >> p.y >> p.z;
+            positions.push_back(p);
+        }
+        else if (tag == "vn")
+        {
+            glm::vec3 n;
+            s >> n.x >> n.y >> n.z;
+            normals.push_back(n);
+        }
+        else if (tag == "vt")
+        {
+            glm::vec2 t;
+            s >> t.x >> t.y;
+            texCoords.push_back(t);
+        }
+        else if (tag == "f")
+        {
+            vector<uint32_t> face;
+            string corner;
+            while (s >> corner)
+            {
+                // v, v/vt, v//vn or v/vt/vn
+                string parts[3];
+                size_t start = 0;
+                for (int k = 0; k < 3; k++)
+                {
+                    size_t slash = corner.find('/', start);
+                    parts[k] = corner.substr(start, slash == string::npos ? string::npos : slash - start);
+                    if (slash == string::npos)
+                        break;
+                    start = slash + 1;
+                }
+
+                ObjCorner key(objIndex(parts[0], positions.size()), objIndex(parts[1], texCoords.size()),
+                    objIndex(parts[2], normals.size()));
+                if (key.position < 0)
+                {
+                    cout << "MESH_CONVERT::Bad face in " << path << ": " << line << endl;
+                    return false;
+                }
+
+                map<ObjCorner, uint32_t>::iterator it = unique.find(key);
+                if (it == unique.end())
+                {
+                    SourceVertex v;
+                    v.position = positions[key.position];
+                    v.texCoord = key.texCoord >= 0 ? texCoords[key.texCoord] : glm::vec2(0.0f);
+                    v.normal = key.normal >= 0 ? normals[key.normal] : glm::vec3(0.0f);
+                    hasNormal.push_back(key.normal >= 0);
+                    it = unique.insert(make_pair(key, (uint32_t)vertices.size())).first;
+                    vertices.push_back(v);
+                }
+                face.push_back(it->second);
+            }
+
+            // polygons become fans
+            for (size_t k = 2; k < face.size(); k++)
+            {
+                indices.push_back(face[0]);
+                indices.push_back(face[k - 1]);
+                indices.push_back(face[k]);
+            }
+        }
+    }
+
+    computeMissingNormals(vertices, indices, hasNormal);
+    return true;
+}
+
+// glTF
+// ----
+
+// just enough JSON for glTF: objects, arrays, strings, numbers, true/false/null
+struct Json
+{
+    enum Type { NONE, OBJECT, ARRAY, STRING, NUMBER, BOOL } type = NONE;
+    map<string, Json> members;
+    vector<Json> items;
+    string text;
+    double number = 0.0;
+
+    const Json& operator[](const string& key) const
+    {
+        static const Json none;
+        map<string, Json>::const_iterator it = members.find(key);
+        return it == members.end() ? none : it->second;
+    }
+
+    const Json& operator[](size_t i) const
+    {
+        static const Json none;
+        return i < items.size() ? items[i] : none;
+    }
+
+    bool has(const string& key) const
+    {
+        return members.count(key) != 0;
+    }
+
+    int integer(int fallback = 0) const
+    {
+        return type == NUMBER ? (int)number : fallback;
+    }
+};
+
+class JsonParser {
+public:
+
+    JsonParser(const char* begin, const char* end) : p(begin), end(end) {}
+
+    bool parse(Json& out)
+    {
+        return value(out);
+    }
+
+private:
+    const char* p;
+    const char* end;
+
+    void skip()
+    {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r'))
+            p++;
+    }
+
+    bool literal(const char* word)
+    {
+        size_t n = strlen(word);
+        if ((size_t)(end - p) < n || strncmp(p, word, n) != 0)
+            return false;
+        p += n;
+        return true;
+    }
+
+    bool string(std::string& out)
+    {
+        if (p >= end || *p != '"')
+            return false;
+        p++;
+        while (p < end && *p != '"')
+        {
+            if (*p == '\\' && p + 1 < end)
+            {
+                p++;
+                switch (*p)
+                {
+                case 'n': out += '\n'; break;
+                case 't': out += '\t'; break;
+                case 'r': out += '\r'; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                // glTF keys and URIs are ASCII, other code points are kept as '?'
+                case 'u': out += '?'; p += std::min<ptrdiff_t>(4, end - p - 1); break;
+                default: out += *p; break;
+                }
+            }
+            else
+                out += *p;
+            p++;
+        }
+        if (p >= end)
+            return false;
+        p++;
+        return true;
+    }
+
+    bool value(Json& out)
+    {
+        skip();
+        if (p >= end)
+            return false;
+
+        if (*p == '{')
+        {
+            out.type = Json::OBJECT;
+            p++;
+            skip();
+            if (p < end && *p == '}')
+                return p++, true;
+            for (;;)
+            {
+                std::string key;
+                skip();
+                if (!string(key))
+                    return false;
+                skip();
+                if (p >= end || *p++ != ':')
+                    return false;
+                if (!value(out.members[key]))
+                    return false;
+                skip();
+                if (p < end && *p == ',')
+                    p++;
+                else if (p < end && *p == '}')
+                    return p++, true;
+                else
+                    return false;
+            }
+        }
+        if (*p == '[')
+        {
+            out.type = Json::ARRAY;
+            p++;
+            skip();
+            if (p < end && *p == ']')
+                return p++, true;
+            for (;;)
+            {
+                out.items.push_back(Json());
+                if (!value(out.items.back()))
+                    return false;
+                skip();
+                if (p < end && *p == ',')
+                    p++;
+                else if (p < end && *p == ']')
+                    return p++, true;
+                else
+                    return false;
+            }
+        }
+        if (*p == '"')
+        {
+            out.type = Json::STRING;
+            return string(out.text);
+        }
+        if (literal("true"))
+        {
+            out.type = Json::BOOL;
+            out.number = 1.0;
+            return true;
+        }
+        if (literal("false"))
+        {
+            out.type = Json::BOOL;
+            return true;
+        }
+        if (literal("null"))
+            return true;
+
+        char* stop;
+        std::string number(p, std::min<ptrdiff_t>(end - p, 64));
+        out.number = strtod(number.c_str(), &stop);
+        if (stop == number.c_str())
+            return false;
+        out.type = Json::NUMBER;
+        p += stop - number.c_str();
+        return true;
+    }
+};
+
+static bool decodeBase64(const string& text, vector<unsigned char>& out)
+{
+    static const string alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    unsigned int bits = 0;
+    int count = 0;
+    for (size_t i = 0; i < text.size() && text[i] != '='; i++)
+    {
+        size_t v = alphabet.find(text[i]);
+        if (v == string::npos)
+            return false;
+        bits = (bits << 6) | (unsigned int)v;
+        count += 6;
+        if (count >= 8)
+        {
+            count -= 8;
+            out.push_back((unsigned char)(bits >> count));
+        }
+    }
+    return true;
+}
+
+struct GltfAccessor
+{
+    const unsigned char* data;
+    size_t count;
+    size_t stride;
+    int componentType;
+    int components;
+};
+
+static int gltfComponents(const string& type)
+{
+    if (type == "SCALAR") return 1;
+    if (type == "VEC2") return 2;
+    if (type == "VEC3") return 3;
+    if (type == "VEC4") return 4;
+    return 0;
+}
+
+static int gltfComponentSize(int componentType)
+{
+    switch (componentType)
+    {
+    case 5120: case 5121: return 1;
+    case 5122: case 5123: return 2;
+    case 5125: case 5126: return 4;
+    }
+    return 0;
+}
+
+static bool gltfAccessor(const Json& gltf, const vector<vector<unsigned char> >& buffers, int index, GltfAccessor& out)
+{
+    const Json& accessor = gltf["accessors"][(size_t)index];
+    const Json& view = gltf["bufferViews"][(size_t)accessor["bufferView"].integer(-1)];
+    if (accessor.type != Json::OBJECT || view.type != Json::OBJECT)
+        return false;
+
+    int buffer = view["buffer"].integer(-1);
+    if (buffer < 0 || buffer >= (int)buffers.size())
+        return false;
+
+    out.componentType = accessor["componentType"].integer();
+    out.components = gltfComponents(accessor["type"].text);
+    out.count = (size_t)accessor["count"].integer();
+    size_t element = (size_t)gltfComponentSize(out.componentType) * out.components;
+    out.stride = view.has("byteStride") ? (size_t)view["byteStride"].integer() : element;
+    size_t offset = (size_t)view["byteOffset"].integer() + (size_t)accessor["byteOffset"].integer();
+    if (element == 0 || out.count == 0)
+        return false;
+
+    size_t last = offset + (out.count - 1) * out.stride + element;
+    if (last > buffers[buffer].size() || last > (size_t)view["byteOffset"].integer() + (size_t)view["byteLength"].integer())
+        return false;
+    out.data = &buffers[buffer][offset];
+    return true;
+}
+
+static float gltfFloat(const GltfAccessor& a, size_t i, int c)
+{
+    float f;
+    memcpy(&f, a.data + i * a.stride + c * 4, 4);
+    return f;
+}
+
+static uint32_t gltfIndex(const GltfAccessor& a, size_t i)
+{
+    const unsigned char* p = a.data + i * a.stride;
+    if (a.componentType == 5121)
+        return *p;
+    if (a.componentType == 5123)
+    {
+        uint16_t v;
+        memcpy(&v, p, 2);
+        return v;
+    }
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+static bool loadGltf(const string& path, vector<SourceVertex>& vertices, vector<uint32_t>& indices)
+{
+    vector<unsigned char> file;
+    if (!readFile(path, file))
+        return false;
+
+    // a .glb is a 12 byte header, a JSON chunk and optionally a BIN chunk
+    const char* jsonBegin = (const char*)file.data();
+    const char* jsonEnd = jsonBegin + file.size();
+    vector<unsigned char> glbBinary;
+    bool glb = file.size() >= 20 && memcmp(file.data(), "glTF", 4) == 0;
+    if (glb)
+    {
+        uint32_t jsonLength;
+        memcpy(&jsonLength, &file[12], 4);
+        if (20 + (size_t)jsonLength > file.size())
+            return false;
+        jsonBegin = (const char*)&file[20];
+        jsonEnd = jsonBegin + jsonLength;
+
+        size_t bin = 20 + (size_t)jsonLength;
+        if (bin + 8 <= file.size())
+        {
+            uint32_t binLength;
+            memcpy(&binLength, &file[bin], 4);
+            if (bin + 8 + binLength <= file.size())
+                glbBinary.assign(file.begin() + bin + 8, file.begin() + bin + 8 + binLength);
+        }
+    }
+
+    Json gltf;
+    JsonParser parser(jsonBegin, jsonEnd);
+    if (!parser.parse(gltf) || gltf.type != Json::OBJECT)
+    {
+        cout << "MESH_CONVERT::Cannot parse " << path << endl;
+        return false;
+    }
+
+    vector<vector<unsigned char> > buffers;
+    const Json& bufferList = gltf["buffers"];
+    for (size_t b = 0; b < bufferList.items.size(); b++)
+    {
+        vector<unsigned char> data;
+        const string& uri = bufferList[b]["uri"].text;
+        if (uri.empty())
+            data = glbBinary;
+        else if (uri.compare(0, 5, "data:") == 0)
+        {
+            size_t comma = uri.find(',');
+            if (comma == string::npos || !decodeBase64(uri.substr(comma + 1), data))
+                return false;
+        }
+        else if (!readFile(directoryOf(path) + uri, data))
+        {
+            cout << "MESH_CONVERT::Cannot read buffer " << uri << endl;
+            return false;
+        }
+        buffers.push_back(data);
+    }
+
+    const Json& meshes = gltf["meshes"];
+    for (size_t m = 0; m < meshes.items.size(); m++)
+    {
+        const Json& primitives = meshes[m]["primitives"];
+        for (size_t p = 0; p < primitives.items.size(); p++)
+        {
+            const Json& primitive = primitives[p];
+            // triangles only
+            if (primitive["mode"].integer(4) != 4)
+                continue;
+
+            const Json& attributes = primitive["attributes"];
+            GltfAccessor position, normal, texCoord, index;
+            if (!gltfAccessor(gltf, buffers, attributes["POSITION"].integer(-1), position) ||
+                position.componentType != 5126 || position.components != 3)
+            {
+                cout << "MESH_CONVERT::Skipping a primitive without float positions" << endl;
+                continue;
+            }
+            bool hasNormals = gltfAccessor(gltf, buffers, attributes["NORMAL"].integer(-1), normal) &&
+                normal.componentType == 5126 && normal.components == 3 && normal.count == position.count;
+            bool hasTexCoords = gltfAccessor(gltf, buffers, attributes["TEXCOORD_0"].integer(-1), texCoord) &&
+                texCoord.componentType == 5126 && texCoord.components == 2 && texCoord.count == position.count;
+
+            uint32_t base = (uint32_t)vertices.size();
+            vector<bool> hasNormal(base, true);
+            for (size_t i = 0; i < position.count; i++)
+            {
+                SourceVertex v;
+                v.position = glm::vec3(gltfFloat(position, i, 0), gltfFloat(position, i, 1), gltfFloat(position, i, 2));
+                v.normal = hasNormals ? glm::vec3(gltfFloat(normal, i, 0), gltfFloat(normal, i, 1), gltfFloat(normal, i, 2)) : glm::vec3(0.0f);
+                v.texCoord = hasTexCoords ? glm::vec2(gltfFloat(texCoord, i, 0), gltfFloat(texCoord, i, 1)) : glm::vec2(0.0f);
+                vertices.push_back(v);
+                hasNormal.push_back(hasNormals);
+            }
+
+            vector<uint32_t> primitiveIndices;
+            if (primitive.has("indices"))
+            {
+                if (!gltfAccessor(gltf, buffers, primitive["indices"].integer(-1), index) || index.components != 1)
+                    return false;
+                for (size_t i = 0; i < index.count; i++)
+                {
+                    uint32_t v = gltfIndex(index, i);
+                    if (v >= position.count)
+                        return false;
+                    primitiveIndices.push_back(base + v);
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < position.count; i++)
+                    primitiveIndices.push_back(base + (uint32_t)i);
+            }
+            primitiveIndices.resize(primitiveIndices.size() - primitiveIndices.size() % 3);
+
+            if (!hasNormals)
+                computeMissingNormals(vertices, primitiveIndices, hasNormal);
+            indices.insert(indices.end(), primitiveIndices.begin(), primitiveIndices.end());
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        cout << "usage: meshConvert input.obj|input.gltf|input.glb output.mesh [lods]" << endl;
+        return 1;
+    }
+
+    string input = argv[1];
+    int lods = argc > 3 ? std::max(1, atoi(argv[3])) : 4;
+    string extension = input.substr(input.find_last_of('.') + 1);
+    for (size_t i = 0; i < extension.size(); i++)
+        extension[i] = (char)tolower(extension[i]);
+
+    vector<SourceVertex> vertices;
+    vector<uint32_t> indices;
+    bool loaded;
+    if (extension == "obj")
+        loaded = loadObj(input, vertices, indices);
+    else if (extension == "gltf" || extension == "glb")
+        loaded = loadGltf(input, vertices, indices);
+    else
+    {
+        cout << "MESH_CONVERT::Unknown file type " << input << endl;
+        return 1;
+    }
+
+    if (!loaded || indices.empty())
+    {
+        cout << "MESH_CONVERT::Nothing to convert in " << input << endl;
+        return 1;
+    }
+
+    if (!writeMeshFile(argv[2], vertices, indices, lods))
+    {
+        cout << "MESH_CONVERT::Cannot write " << argv[2] << endl;
+        return 1;
+    }
+
+    cout << input << ": " << vertices.size() << " vertices, " << indices.size() / 3 << " triangles -> " << argv[2] << endl;
+    return 0;
+}
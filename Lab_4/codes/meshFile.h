@@ -0,0 +1,320 @@
+//
+//  meshFile.h
+//  test
+//
+//  Loads a mesh written by meshConvert (format in meshFormat.h) by mapping the file
+//  into memory. Every section is checked against the file size, LOD and meshlet
+//  ranges against the index count and every index against the vertex count, so a
+//  corrupt file is refused before it reaches GL. The vertex and index sections then
+//  go straight from the mapping to glBufferData: nothing is copied on the way, so
+//  loading costs about as much as reading the file. The mapping is released
+//  once the buffers exist; LODs and meshlets are kept for drawing and culling.
+//
+//  Attributes use the locations of the lab shaders: position 0, normal 1 and
+//  texture coordinate 2, so the mesh draws with the same shaders as Cube.
+//
+
+#ifndef meshFile_h
+#define meshFile_h
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "shader.h"
+#include "meshFormat.h"
+
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// a read-only view of a whole file
+class MappedFile {
+public:
+
+    ~MappedFile()
+    {
+        close();
+    }
+
+    bool open(const char* path)
+    {
+        close();
+#ifdef _WIN32
+        file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+            return false;
+        mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping == NULL)
+            return false;
+        bytes = (const unsigned char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        size = (size_t)fileSize.QuadPart;
+#else
+        fd = ::open(path, O_RDONLY);
+        if (fd < 0)
+            return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0)
+            return false;
+        void* p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED)
+            return false;
+        // read ahead in big chunks, the upload walks the file front to back;
+        // advice values are not flags, so each one takes a call of its own
+        madvise(p, (size_t)st.st_size, MADV_SEQUENTIAL);
+        madvise(p, (size_t)st.st_size, MADV_WILLNEED);
+        bytes = (const unsigned char*)p;
+        size = (size_t)st.st_size;
+#endif
+        return bytes != NULL;
+    }
+
+    void close()
+    {
+#ifdef _WIN32
+        if (bytes != NULL)
+            UnmapViewOfFile(bytes);
+        if (mapping != NULL)
+            CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE)
+            CloseHandle(file);
+        mapping = NULL;
+        file = INVALID_HANDLE_VALUE;
+#else
+        if (bytes != NULL)
+            munmap((void*)bytes, size);
+        if (fd >= 0)
+            ::close(fd);
+        fd = -1;
+#endif
+        bytes = NULL;
+        size = 0;
+    }
+
+    const unsigned char* data() const { return bytes; }
+    size_t length() const { return size; }
+
+private:
+    const unsigned char* bytes = NULL;
+    size_t size = 0;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = NULL;
+#else
+    int fd = -1;
+#endif
+};
+
+class MeshFile {
+public:
+
+    // materialistic property
+    glm::vec3 ambient;
+    glm::vec3 diffuse;
+    glm::vec3 specular;
+
+    // texture property
+    unsigned int textureMap;
+
+    // common property
+    float shininess;
+
+    std::vector<MeshFileLod> lods;
+    std::vector<MeshFileMeshlet> meshlets;
+    glm::vec3 boundsCenter;
+    float boundsRadius = 0.0f;
+
+    MeshFile(unsigned int tMap, glm::vec3 amb = glm::vec3(1.0f, 0.5f, 0.3f),
+        glm::vec3 diff = glm::vec3(1.0f, 0.5f, 0.3f),
+        glm::vec3 spec = glm::vec3(0.5f, 0.5f, 0.5f),
+        float shiny = 32.0f)
+    {
+        this->textureMap = tMap;
+        this->ambient = amb;
+        this->diffuse = diff;
+        this->specular = spec;
+        this->shininess = shiny;
+    }
+
+    ~MeshFile()
+    {
+        release();
+    }
+
+    // maps the file and uploads it; needs a current context
+    bool load(const char* path)
+    {
+        release();
+
+        MappedFile file;
+        if (!file.open(path))
+        {
+            std::cout << "MESH_FILE::Cannot map " << path << std::endl;
+            return false;
+        }
+
+        const unsigned char* bytes = file.data();
+        MeshFileHeader header;
+        if (file.length() < sizeof(header))
+            return fail(path, "too small");
+        memcpy(&header, bytes, sizeof(header));
+
+        if (memcmp(header.magic, MESH_FILE_MAGIC, 4) != 0 || header.version != MESH_FILE_VERSION)
+            return fail(path, "not a supported mesh file");
+        if (header.indexSize != 2 && header.indexSize != 4)
+            return fail(path, "bad index size");
+        if (!section(file, header.vertexOffset, (uint64_t)header.vertexCount * sizeof(MeshFileVertex)) ||
+            !section(file, header.indexOffset, (uint64_t)header.indexCount * header.indexSize) ||
+            !section(file, header.lodOffset, (uint64_t)header.lodCount * sizeof(MeshFileLod)) ||
+            !section(file, header.meshletOffset, (uint64_t)header.meshletCount * sizeof(MeshFileMeshlet)))
+            return fail(path, "section out of bounds");
+
+        const MeshFileLod* fileLods = (const MeshFileLod*)(bytes + header.lodOffset);
+        for (uint32_t i = 0; i < header.lodCount; i++)
+            if ((uint64_t)fileLods[i].firstIndex + fileLods[i].indexCount > header.indexCount ||
+                (uint64_t)fileLods[i].firstMeshlet + fileLods[i].meshletCount > header.meshletCount)
+                return fail(path, "LOD out of bounds");
+        lods.assign(fileLods, fileLods + header.lodCount);
+
+        const MeshFileMeshlet* fileMeshlets = (const MeshFileMeshlet*)(bytes + header.meshletOffset);
+        for (uint32_t i = 0; i < header.meshletCount; i++)
+            if ((uint64_t)fileMeshlets[i].firstIndex + fileMeshlets[i].indexCount > header.indexCount)
+                return fail(path, "meshlet out of bounds");
+        meshlets.assign(fileMeshlets, fileMeshlets + header.meshletCount);
+
+        // one pass over the indices, they are read anyway by the upload below
+        const unsigned char* indices = bytes + header.indexOffset;
+        if (header.indexSize == 2 ? !indicesInRange((const uint16_t*)indices, header.indexCount, header.vertexCount)
+                                  : !indicesInRange((const uint32_t*)indices, header.indexCount, header.vertexCount))
+            return fail(path, "index out of range");
+
+        boundsCenter = glm::vec3(header.boundsCenter[0], header.boundsCenter[1], header.boundsCenter[2]);
+        boundsRadius = header.boundsRadius;
+        indexType = header.indexSize == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+        indexSize = header.indexSize;
+
+        glGenVertexArrays(1, &meshVAO);
+        glGenBuffers(1, &meshVBO);
+        glGenBuffers(1, &meshEBO);
+
+        glBindVertexArray(meshVAO);
+
+        // straight from the mapping, the file layout is the buffer layout
+        glBindBuffer(GL_ARRAY_BUFFER, meshVBO);
+        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)header.vertexCount * sizeof(MeshFileVertex), bytes + header.vertexOffset, GL_STATIC_DRAW);
+
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshEBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)header.indexCount * header.indexSize, bytes + header.indexOffset, GL_STATIC_DRAW);
+
+        // position attribute
+        glVertexAttribPointer(0, 4, GL_HALF_FLOAT, GL_FALSE, sizeof(MeshFileVertex), (void*)offsetof(MeshFileVertex, position));
+        glEnableVertexAttribArray(0);
+
+        // vertex normal attribute
+        glVertexAttribPointer(1, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(MeshFileVertex), (void*)offsetof(MeshFileVertex, normal));
+        glEnableVertexAttribArray(1);
+
+        // texture coordinate attribute
+        glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(MeshFileVertex), (void*)offsetof(MeshFileVertex, texCoord));
+        glEnableVertexAttribArray(2);
+
+        glBindVertexArray(0);
+        return true;
+    }
+
+    int lodCount() const
+    {
+        return (int)lods.size();
+    }
+
+    // picks the coarsest LOD whose error stays under maxError, e.g. a pixel's worth
+    // of object space at the mesh's distance
+    int selectLod(float maxError) const
+    {
+        int lod = 0;
+        for (int i = 1; i < (int)lods.size(); i++)
+            if (lods[i].error <= maxError)
+                lod = i;
+        return lod;
+    }
+
+    void draw(Shader& lightingShaderWithTexture, glm::mat4 model = glm::mat4(1.0f), int lod = 0)
+    {
+        if (meshVAO == 0 || lods.empty())
+            return;
+        lod = std::min(std::max(lod, 0), (int)lods.size() - 1);
+
+        lightingShaderWithTexture.use();
+
+        lightingShaderWithTexture.setInt("texUnit", 0);
+        lightingShaderWithTexture.setVec3("material.ambient", this->ambient);
+        lightingShaderWithTexture.setVec3("material.diffuse", this->diffuse);
+        lightingShaderWithTexture.setVec3("material.specular", this->specular);
+        lightingShaderWithTexture.setFloat("material.shininess", this->shininess);
+
+        // bind diffuse map
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, this->textureMap);
+
+        lightingShaderWithTexture.setMat4("model", model);
+
+        glBindVertexArray(meshVAO);
+        glDrawElements(GL_TRIANGLES, lods[lod].indexCount, indexType, (void*)((size_t)lods[lod].firstIndex * indexSize));
+    }
+
+private:
+    unsigned int meshVAO = 0;
+    unsigned int meshVBO = 0;
+    unsigned int meshEBO = 0;
+    GLenum indexType = GL_UNSIGNED_INT;
+    uint32_t indexSize = 4;
+
+    static bool section(const MappedFile& file, uint64_t offset, uint64_t size)
+    {
+        return offset <= file.length() && size <= file.length() - offset;
+    }
+
+    template<typename T>
+    static bool indicesInRange(const T* indices, uint32_t count, uint32_t vertexCount)
+    {
+        T maxIndex = 0;
+        for (uint32_t i = 0; i < count; i++)
+            maxIndex = indices[i] > maxIndex ? indices[i] : maxIndex;
+        return count == 0 || (uint64_t)maxIndex < vertexCount;
+    }
+
+    static bool fail(const char* path, const char* reason)
+    {
+        std::cout << "MESH_FILE::" << path << ": " << reason << std::endl;
+        return false;
+    }
+
+    void release()
+    {
+        if (meshVAO != 0)
+        {
+            glDeleteVertexArrays(1, &meshVAO);
+            glDeleteBuffers(1, &meshVBO);
+            glDeleteBuffers(1, &meshEBO);
+        }
+        meshVAO = meshVBO = meshEBO = 0;
+        lods.clear();
+        meshlets.clear();
+    }
+};
+
+#endif /* meshFile_h */
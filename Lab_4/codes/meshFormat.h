@@ -0,0 +1,294 @@
+//
+//  meshFormat.h
+//  test
+//
+//  The binary mesh container read by meshFile.h and written by meshConvert.cpp.
+//  Everything the GPU reads is stored exactly the way GL wants it, so loading is
+//  mapping the file and handing the vertex and index sections to glBufferData.
+//
+//  Layout, little-endian, every section 16 byte aligned:
+//
+//    MeshFileHeader   magic, counts, bounds and the offset of every section
+//    vertices         MeshFileVertex[vertexCount], 16 bytes each:
+//                       position   4 x half (w = 1)
+//                       normal     snorm 10/10/10/2, GL_INT_2_10_10_10_REV
+//                       texcoord   2 x half
+//    indices          uint16 or uint32 (indexSize), every LOD back to back
+//    lods             MeshFileLod[lodCount], finest first
+//    meshlets         MeshFileMeshlet[meshletCount], grouped by LOD
+//
+//  All LODs share the vertex buffer; a LOD is a range of indices, split into
+//  meshlets of at most MESHLET_MAX_VERTICES vertices and MESHLET_MAX_TRIANGLES
+//  triangles with a bounding sphere each, so whole clusters can be culled.
+//
+//  Nothing here needs GL, so the converter can include it on its own.
+//
+
+#ifndef meshFormat_h
+#define meshFormat_h
+
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#define MESH_FILE_MAGIC "LMSH"
+#define MESH_FILE_VERSION 1
+#define MESHLET_MAX_VERTICES 64
+#define MESHLET_MAX_TRIANGLES 124
+
+struct MeshFileHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t vertexCount;
+    uint32_t indexCount;
+    // 2 or 4 bytes
+    uint32_t indexSize;
+    uint32_t lodCount;
+    uint32_t meshletCount;
+    uint32_t reserved;
+    // sphere around every position
+    float boundsCenter[3];
+    float boundsRadius;
+    uint64_t vertexOffset;
+    uint64_t indexOffset;
+    uint64_t lodOffset;
+    uint64_t meshletOffset;
+    uint64_t fileSize;
+    uint64_t reserved2;
+};
+
+struct MeshFileVertex
+{
+    uint64_t position;
+    uint32_t normal;
+    uint32_t texCoord;
+};
+
+struct MeshFileLod
+{
+    uint32_t firstIndex;
+    uint32_t indexCount;
+    uint32_t firstMeshlet;
+    uint32_t meshletCount;
+    // object space distance vertices were moved by simplification
+    float error;
+    uint32_t reserved[3];
+};
+
+struct MeshFileMeshlet
+{
+    uint32_t firstIndex;
+    uint32_t indexCount;
+    uint32_t vertexCount;
+    uint32_t reserved;
+    float center[3];
+    float radius;
+};
+
+// what the converter gathers from a source file before quantization
+struct SourceVertex
+{
+    glm::vec3 position;
+    glm::vec3 normal;
+    glm::vec2 texCoord;
+};
+
+inline MeshFileVertex packMeshVertex(const SourceVertex& v)
+{
+    MeshFileVertex p;
+    p.position = glm::packHalf4x16(glm::vec4(v.position, 1.0f));
+    float length = glm::length(v.normal);
+    glm::vec3 n = length > 0.0f ? v.normal / length : glm::vec3(0.0f, 1.0f, 0.0f);
+    p.normal = glm::packSnorm3x10_1x2(glm::vec4(n, 0.0f));
+    p.texCoord = glm::packHalf2x16(v.texCoord);
+    return p;
+}
+
+// simplifies by snapping vertices to a grid of cellSize and keeping the first
+// vertex of every cell; triangles that collapse are dropped
+inline std::vector<uint32_t> clusterIndices(const std::vector<SourceVertex>& vertices,
+    const std::vector<uint32_t>& indices, glm::vec3 origin, float cellSize)
+{
+    std::vector<uint32_t> remap(vertices.size());
+    std::unordered_map<uint64_t, uint32_t> cells;
+    for (size_t i = 0; i < vertices.size(); i++)
+    {
+        glm::vec3 c = glm::floor((vertices[i].position - origin) / cellSize);
+        uint64_t key = ((uint64_t)((int64_t)c.x & 0x1FFFFF) << 42)
+            | ((uint64_t)((int64_t)c.y & 0x1FFFFF) << 21)
+            | (uint64_t)((int64_t)c.z & 0x1FFFFF);
+        remap[i] = cells.insert(std::make_pair(key, (uint32_t)i)).first->second;
+    }
+
+    std::vector<uint32_t> result;
+    for (size_t t = 0; t + 2 < indices.size(); t += 3)
+    {
+        uint32_t a = remap[indices[t]], b = remap[indices[t + 1]], c = remap[indices[t + 2]];
+        if (a != b && b != c && a != c)
+        {
+            result.push_back(a);
+            result.push_back(b);
+            result.push_back(c);
+        }
+    }
+    return result;
+}
+
+// cuts a LOD into meshlets by walking its triangles in order; indices stay where they are
+inline void buildMeshlets(const std::vector<SourceVertex>& vertices, const std::vector<uint32_t>& indices,
+    uint32_t firstIndex, uint32_t indexCount, std::vector<MeshFileMeshlet>& meshlets)
+{
+    std::vector<uint32_t> used;
+    uint32_t start = firstIndex;
+    uint32_t end = firstIndex + indexCount;
+
+    for (uint32_t t = firstIndex; t <= end; t += 3)
+    {
+        bool last = t == end;
+        size_t fresh = 0;
+        if (!last)
+            for (int k = 0; k < 3; k++)
+                if (std::find(used.begin(), used.end(), indices[t + k]) == used.end())
+                    fresh++;
+
+        bool full = used.size() + fresh > MESHLET_MAX_VERTICES || (t - start) / 3 >= MESHLET_MAX_TRIANGLES;
+        if ((last || full) && t > start)
+        {
+            MeshFileMeshlet m = {};
+            m.firstIndex = start;
+            m.indexCount = t - start;
+            m.vertexCount = (uint32_t)used.size();
+
+            glm::vec3 center(0.0f);
+            for (size_t i = 0; i < used.size(); i++)
+                center += vertices[used[i]].position;
+            center /= (float)used.size();
+            float radius = 0.0f;
+            for (size_t i = 0; i < used.size(); i++)
+                radius = std::max(radius, glm::length(vertices[used[i]].position - center));
+
+            m.center[0] = center.x;
+            m.center[1] = center.y;
+            m.center[2] = center.z;
+            m.radius = radius;
+            meshlets.push_back(m);
+
+            start = t;
+            used.clear();
+        }
+        if (last)
+            break;
+
+        for (int k = 0; k < 3; k++)
+            if (std::find(used.begin(), used.end(), indices[t + k]) == used.end())
+                used.push_back(indices[t + k]);
+    }
+}
+
+inline uint64_t alignMeshSection(uint64_t offset)
+{
+    return (offset + 15) & ~(uint64_t)15;
+}
+
+// writes a mesh file with up to maxLods levels of detail, each simplified from the
+// full mesh with a grid twice as coarse as the last; returns false if it cannot write
+inline bool writeMeshFile(const char* path, const std::vector<SourceVertex>& vertices,
+    const std::vector<uint32_t>& indices, int maxLods = 4)
+{
+    if (vertices.empty() || indices.size() < 3)
+        return false;
+
+    glm::vec3 lo = vertices[0].position, hi = vertices[0].position;
+    for (size_t i = 1; i < vertices.size(); i++)
+    {
+        lo = glm::min(lo, vertices[i].position);
+        hi = glm::max(hi, vertices[i].position);
+    }
+    glm::vec3 center = (lo + hi) * 0.5f;
+    float radius = 0.0f;
+    for (size_t i = 0; i < vertices.size(); i++)
+        radius = std::max(radius, glm::length(vertices[i].position - center));
+
+    // LOD 0 is the mesh itself; coarser ones stop once they no longer shrink much
+    std::vector<uint32_t> allIndices(indices.begin(), indices.end() - indices.size() % 3);
+    std::vector<MeshFileLod> lods(1);
+    lods[0].indexCount = (uint32_t)allIndices.size();
+
+    float extent = std::max(hi.x - lo.x, std::max(hi.y - lo.y, hi.z - lo.z));
+    float cellSize = extent / 64.0f;
+    for (int l = 1; l < maxLods && extent > 0.0f; l++, cellSize *= 2.0f)
+    {
+        std::vector<uint32_t> simplified = clusterIndices(vertices, indices, lo, cellSize);
+        uint32_t previous = lods.back().indexCount;
+        if (simplified.empty() || simplified.size() * 4 > (size_t)previous * 3)
+            continue;
+
+        MeshFileLod lod = {};
+        lod.firstIndex = (uint32_t)allIndices.size();
+        lod.indexCount = (uint32_t)simplified.size();
+        lod.error = cellSize;
+        lods.push_back(lod);
+        allIndices.insert(allIndices.end(), simplified.begin(), simplified.end());
+    }
+
+    std::vector<MeshFileMeshlet> meshlets;
+    for (size_t l = 0; l < lods.size(); l++)
+    {
+        lods[l].firstMeshlet = (uint32_t)meshlets.size();
+        buildMeshlets(vertices, allIndices, lods[l].firstIndex, lods[l].indexCount, meshlets);
+        lods[l].meshletCount = (uint32_t)meshlets.size() - lods[l].firstMeshlet;
+    }
+
+    MeshFileHeader header = {};
+    memcpy(header.magic, MESH_FILE_MAGIC, 4);
+    header.version = MESH_FILE_VERSION;
+    header.vertexCount = (uint32_t)vertices.size();
+    header.indexCount = (uint32_t)allIndices.size();
+    header.indexSize = vertices.size() <= 0xFFFF ? 2 : 4;
+    header.lodCount = (uint32_t)lods.size();
+    header.meshletCount = (uint32_t)meshlets.size();
+    header.boundsCenter[0] = center.x;
+    header.boundsCenter[1] = center.y;
+    header.boundsCenter[2] = center.z;
+    header.boundsRadius = radius;
+    header.vertexOffset = alignMeshSection(sizeof(MeshFileHeader));
+    header.indexOffset = alignMeshSection(header.vertexOffset + vertices.size() * sizeof(MeshFileVertex));
+    header.lodOffset = alignMeshSection(header.indexOffset + allIndices.size() * header.indexSize);
+    header.meshletOffset = alignMeshSection(header.lodOffset + lods.size() * sizeof(MeshFileLod));
+    header.fileSize = header.meshletOffset + meshlets.size() * sizeof(MeshFileMeshlet);
+
+    std::vector<unsigned char> file((size_t)header.fileSize, 0);
+    memcpy(&file[0], &header, sizeof(header));
+
+    MeshFileVertex* packed = (MeshFileVertex*)&file[(size_t)header.vertexOffset];
+    for (size_t i = 0; i < vertices.size(); i++)
+        packed[i] = packMeshVertex(vertices[i]);
+
+    for (size_t i = 0; i < allIndices.size(); i++)
+    {
+        if (header.indexSize == 2)
+            ((uint16_t*)&file[(size_t)header.indexOffset])[i] = (uint16_t)allIndices[i];
+        else
+            ((uint32_t*)&file[(size_t)header.indexOffset])[i] = allIndices[i];
+    }
+
+    memcpy(&file[(size_t)header.lodOffset], lods.data(), lods.size() * sizeof(MeshFileLod));
+    if (!meshlets.empty())
+        memcpy(&file[(size_t)header.meshletOffset], meshlets.data(), meshlets.size() * sizeof(MeshFileMeshlet));
+
+    FILE* out = fopen(path, "wb");
+    if (out == NULL)
+        return false;
+    bool ok = fwrite(file.data(), 1, file.size(), out) == file.size();
+    return fclose(out) == 0 && ok;
+}
+
+#endif /* meshFormat_h */
@@ -17,6 +17,48 @@
 
 using namespace std;
 
+// vertex data shared by every instance: position (3), normal (3), texture coordinate (2)
+static const float pyra_vertices[] = {
+    // positions      // normals         // texture
+    // back
+    -0.5f, -0.5f, -0.5f, 0.0f, 1.0f, -1.0f, 1, 0,
+    0.5f, -0.5f, -0.5f, 0.0f, 1.0f, -1.0f, 0, 0,
+    0.0f, 0.5f, 0.0f, 0.0f, 1.0f, -1.0f, 0.5, 1,
+
+    // right
+    0.5f, -0.5f, -0.5f, 1.0f,1.0f, 0.0f, 1, 0,
+    0.5f, -0.5f, 0.5f, 1.0f, 1.0f, 0.0f, 0, 0,
+    0.0f, 0.5f, 0.0f, 1.0f, 1.0f, 0.0f, 0.5, 1,
+
+    // front
+    -0.5f, -0.5f, 0.5f, 0.0f, 1.0f, 1.0f, 0, 0,
+    0.5f, -0.5f, 0.5f, 0.0f, 1.0f, 1.0f, 1, 0,
+    0.0f, 0.5f, 0.0f, 0.0f, 1.0f, 1.0f, 0.5, 1,
+
+    // left
+    -0.5f, -0.5f, -0.5f, -1.0f, 1.0f, 0.0f, 0, 0,
+    -0.5f, -0.5f, 0.5f, -1.0f, 1.0f, 0.0f, 1, 0,
+    0.0f, 0.5f, 0.0f, -1.0f, 1.0f, 0.0f, 0.5, 1,
+
+    // bottom
+    -0.5f, -0.5f, -0.5f, 0.0f, -1.0f, 0.0f, 0, 0,
+    0.5f, -0.5f, -0.5f, 0.0f, -1.0f, 0.0f, 1, 0,
+    0.5f, -0.5f, 0.5f, 0.0f, -1.0f, 0.0f, 1, 1,
+    -0.5f, -0.5f, 0.5f, 0.0f, -1.0f, 0.0f, 0, 1
+};
+static const unsigned int pyra_indices[] = {
+    1, 0, 2,
+
+    4, 3, 5,
+
+    6, 7, 8,
+
+    9, 10, 11,
+
+    12, 13, 14,
+    14, 15, 12
+};
+
 class Pyramid {
 public:
 
@@ -107,46 +149,6 @@ private:
         // set up vertex data (and buffer(s)) and configure vertex attributes
         // ------------------------------------------------------------------
 
-        float pyra_vertices[] = {
-            // positions      // normals         // texture
-            // back
-            -0.5f, -0.5f, -0.5f, 0.0f, 1.0f, -1.0f, 1, 0,
-            0.5f, -0.5f, -0.5f, 0.0f, 1.0f, -1.0f, 0, 0,
-            0.0f, 0.5f, 0.0f, 0.0f, 1.0f, -1.0f, 0.5, 1,
-
-            // right
-            0.5f, -0.5f, -0.5f, 1.0f,1.0f, 0.0f, 1, 0,
-            0.5f, -0.5f, 0.5f, 1.0f, 1.0f, 0.0f, 0, 0,
-            0.0f, 0.5f, 0.0f, 1.0f, 1.0f, 0.0f, 0.5, 1,
-
-            // front
-            -0.5f, -0.5f, 0.5f, 0.0f, 1.0f, 1.0f, 0, 0,
-            0.5f, -0.5f, 0.5f, 0.0f, 1.0f, 1.0f, 1, 0,
-            0.0f, 0.5f, 0.0f, 0.0f, 1.0f, 1.0f, 0.5, 1,
-
-            // left
-            -0.5f, -0.5f, -0.5f, -1.0f, 1.0f, 0.0f, 0, 0,
-            -0.5f, -0.5f, 0.5f, -1.0f, 1.0f, 0.0f, 1, 0,
-            0.0f, 0.5f, 0.0f, -1.0f, 1.0f, 0.0f, 0.5, 1,
-
-            // bottom
-            -0.5f, -0.5f, -0.5f, 0.0f, -1.0f, 0.0f, 0, 0,
-            0.5f, -0.5f, -0.5f, 0.0f, -1.0f, 0.0f, 1, 0,
-            0.5f, -0.5f, 0.5f, 0.0f, -1.0f, 0.0f, 1, 1,
-            -0.5f, -0.5f, 0.5f, 0.0f, -1.0f, 0.0f, 0, 1
-        };
-        unsigned int pyra_indices[] = {
-            1, 0, 2,
-
-            4, 3, 5,
-
-            6, 7, 8,
-
-            9, 10, 11,
-
-            12, 13, 14,
-            14, 15, 12
-        };
 
         glGenVertexArrays(1, &pyraVAO);
         glGenVertexArrays(1, &lightPyramidVAO);
@@ -0,0 +1,385 @@
+//
+//  staticBatch.h
+//  test
+//
+//  Draws large amounts of static scenery made of the lab primitives in one call.
+//  The cube, pyramid and hexagon meshes are merged into one vertex/index buffer and
+//  every object gets a model matrix in an instance buffer, grouped by mesh. With
+//  GL 4.3 (or ARB_multi_draw_indirect) the whole batch is a single
+//  glMultiDrawElementsIndirect with one record per mesh; each record's baseInstance
+//  selects the mesh's run of model matrices. On a plain 3.3 context each mesh is
+//  drawn with an instanced call of its own instead.
+//
+//  Every frame the objects can be culled against the camera: cull() tests a range
+//  of objects and compact() packs the visible ones of a mesh to the front of its
+//  run, so both are safe to spread over threads as long as ranges and meshes do not
+//  overlap. uploadVisible() then hands the result to GL on the context thread.
+//
+//  Use vertexShaderForPhongShadingWithTextureInstanced.vs, which reads the model
+//  matrix from attribute 3 instead of a uniform.
+//
+
+#ifndef staticBatch_h
+#define staticBatch_h
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+#include "shader.h"
+#include "cube.h"
+#include "hexagon.h"
+#include "pyramid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// glad is generated for 3.3 core, so the 4.3 entry point is loaded by hand
+#ifndef GL_DRAW_INDIRECT_BUFFER
+#define GL_DRAW_INDIRECT_BUFFER 0x8F3F
+#endif
+typedef void (APIENTRYP PFNGLMULTIDRAWELEMENTSINDIRECTPROC_LOCAL)(GLenum mode, GLenum type, const void* indirect, GLsizei drawcount, GLsizei stride);
+
+enum StaticMesh {
+    STATIC_CUBE,
+    STATIC_PYRAMID,
+    STATIC_HEXAGON,
+    STATIC_MESH_COUNT
+};
+
+class StaticBatch {
+public:
+
+    // materialistic property
+    glm::vec3 ambient;
+    glm::vec3 diffuse;
+    glm::vec3 specular;
+
+    // texture property
+    unsigned int textureMap;
+
+    // common property
+    float shininess;
+
+    StaticBatch(unsigned int tMap, glm::vec3 amb = glm::vec3(1.0f, 0.5f, 0.3f),
+        glm::vec3 diff = glm::vec3(1.0f, 0.5f, 0.3f),
+        glm::vec3 spec = glm::vec3(0.5f, 0.5f, 0.5f),
+        float shiny = 32.0f)
+    {
+        this->textureMap = tMap;
+        this->ambient = amb;
+        this->diffuse = diff;
+        this->specular = spec;
+        this->shininess = shiny;
+
+        setUpMergedMeshes();
+
+        // needs a current context; base instances in indirect records need 4.2 as well
+        GLint major = 0, minor = 0;
+        glGetIntegerv(GL_MAJOR_VERSION, &major);
+        glGetIntegerv(GL_MINOR_VERSION, &minor);
+        bool gl43 = major > 4 || (major == 4 && minor >= 3);
+        bool gl42 = major > 4 || (major == 4 && minor >= 2);
+        if ((gl43 || glfwExtensionSupported("GL_ARB_multi_draw_indirect")) &&
+            (gl42 || glfwExtensionSupported("GL_ARB_base_instance")))
+        {
+            multiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC_LOCAL)glfwGetProcAddress("glMultiDrawElementsIndirect");
+        }
+    }
+
+    ~StaticBatch()
+    {
+        glDeleteVertexArrays(1, &batchVAO);
+        glDeleteBuffers(1, &batchVBO);
+        glDeleteBuffers(1, &batchEBO);
+        glDeleteBuffers(1, &instanceVBO);
+        glDeleteBuffers(1, &indirectBuffer);
+    }
+
+    // queue one object; takes effect on the next build()
+    void add(StaticMesh mesh, const glm::mat4& model)
+    {
+        Object o;
+        o.mesh = mesh;
+        o.model = model;
+        objects.push_back(o);
+    }
+
+    // uploads the instance and indirect buffers with every object visible; call once
+    // after adding the scenery
+    void build()
+    {
+        // group objects by mesh so each mesh is one contiguous run of instances
+        models.clear();
+        bounds.clear();
+        for (int m = 0; m < STATIC_MESH_COUNT; m++)
+        {
+            groupFirst[m] = (GLuint)models.size();
+            for (size_t i = 0; i < objects.size(); i++)
+            {
+                if (objects[i].mesh != m)
+                    continue;
+
+                const glm::mat4& model = objects[i].model;
+                float scale = std::max(glm::length(glm::vec3(model[0])),
+                    std::max(glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2]))));
+                models.push_back(model);
+                bounds.push_back(glm::vec4(glm::vec3(model[3]), meshRadius[m] * scale));
+            }
+            groupCount[m] = (GLsizei)models.size() - groupFirst[m];
+            visibleCount[m] = groupCount[m];
+        }
+        visible.assign(models.size(), 1);
+        visibleModels = models;
+
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+        glBufferData(GL_ARRAY_BUFFER, models.size() * sizeof(glm::mat4), models.data(), GL_DYNAMIC_DRAW);
+        uploadCommands();
+    }
+
+    size_t objectCount() const
+    {
+        return models.size();
+    }
+
+    // takes the planes objects are culled against from projection * view (Gribb/Hartmann)
+    void setCullMatrix(const glm::mat4& viewProjection)
+    {
+        glm::mat4 rows = glm::transpose(viewProjection);
+        cullPlanes[0] = rows[3] + rows[0];
+        cullPlanes[1] = rows[3] - rows[0];
+        cullPlanes[2] = rows[3] + rows[1];
+        cullPlanes[3] = rows[3] - rows[1];
+        cullPlanes[4] = rows[3] + rows[2];
+        cullPlanes[5] = rows[3] - rows[2];
+        for (int i = 0; i < 6; i++)
+            cullPlanes[i] /= glm::length(glm::vec3(cullPlanes[i]));
+    }
+
+    // tests the bounding spheres of objects [begin, end) against the cull planes
+    void cull(size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            glm::vec3 center(bounds[i]);
+            unsigned char in = 1;
+            for (int p = 0; p < 6; p++)
+                if (glm::dot(glm::vec3(cullPlanes[p]), center) + cullPlanes[p].w < -bounds[i].w)
+                    in = 0;
+            visible[i] = in;
+        }
+    }
+
+    // packs the visible objects of one mesh to the front of its run; needs cull()
+    // to have covered that run
+    void compact(StaticMesh mesh)
+    {
+        GLuint first = groupFirst[mesh];
+        GLuint n = 0;
+        for (GLuint i = first; i < first + (GLuint)groupCount[mesh]; i++)
+            if (visible[i])
+                visibleModels[first + n++] = models[i];
+        visibleCount[mesh] = (GLsizei)n;
+    }
+
+    // streams the compacted instances and draw records; context thread only
+    void uploadVisible()
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+        for (int m = 0; m < STATIC_MESH_COUNT; m++)
+            if (visibleCount[m] > 0)
+                glBufferSubData(GL_ARRAY_BUFFER, groupFirst[m] * sizeof(glm::mat4),
+                    visibleCount[m] * sizeof(glm::mat4), &visibleModels[groupFirst[m]]);
+        uploadCommands();
+    }
+
+    // objects drawn by the next draw()
+    size_t visibleObjectCount() const
+    {
+        size_t n = 0;
+        for (int m = 0; m < STATIC_MESH_COUNT; m++)
+            n += visibleCount[m];
+        return n;
+    }
+
+    void draw(Shader& lightingShaderWithTextureInstanced)
+    {
+        if (visibleObjectCount() == 0)
+            return;
+
+        lightingShaderWithTextureInstanced.use();
+
+        lightingShaderWithTextureInstanced.setInt("texUnit", 0);
+        lightingShaderWithTextureInstanced.setVec3("material.ambient", this->ambient);
+        lightingShaderWithTextureInstanced.setVec3("material.diffuse", this->diffuse);
+        lightingShaderWithTextureInstanced.setVec3("material.specular", this->specular);
+        lightingShaderWithTextureInstanced.setFloat("material.shininess", this->shininess);
+
+        // bind diffuse map
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, this->textureMap);
+
+        glBindVertexArray(batchVAO);
+
+        if (multiDrawElementsIndirect != NULL)
+        {
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer);
+            multiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, 0, STATIC_MESH_COUNT, 0);
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+            return;
+        }
+
+        // 3.3 has no base instance, so point the instance attribute at each mesh's run
+        for (int m = 0; m < STATIC_MESH_COUNT; m++)
+        {
+            if (visibleCount[m] == 0)
+                continue;
+            setInstanceAttribute(groupFirst[m] * sizeof(glm::mat4));
+            glDrawElementsInstanced(GL_TRIANGLES, meshIndexCount[m], GL_UNSIGNED_INT,
+                (void*)(meshFirstIndex[m] * sizeof(unsigned int)), visibleCount[m]);
+        }
+    }
+
+    bool usesMultiDrawIndirect() const
+    {
+        return multiDrawElementsIndirect != NULL;
+    }
+
+private:
+
+    // layout defined by GL_DRAW_INDIRECT_BUFFER
+    struct DrawElementsIndirectCommand {
+        GLuint count;
+        GLuint instanceCount;
+        GLuint firstIndex;
+        GLint baseVertex;
+        GLuint baseInstance;
+    };
+
+    struct Object {
+        StaticMesh mesh;
+        glm::mat4 model;
+    };
+
+    std::vector<Object> objects;
+
+    // in build order, grouped by mesh; bounds are world space spheres (center, radius)
+    std::vector<glm::mat4> models;
+    std::vector<glm::vec4> bounds;
+    std::vector<unsigned char> visible;
+    std::vector<glm::mat4> visibleModels;
+    glm::vec4 cullPlanes[6];
+
+    unsigned int batchVAO;
+    unsigned int batchVBO;
+    unsigned int batchEBO;
+    unsigned int instanceVBO;
+    unsigned int indirectBuffer;
+
+    GLuint meshFirstIndex[STATIC_MESH_COUNT];
+    GLuint meshIndexCount[STATIC_MESH_COUNT];
+    float meshRadius[STATIC_MESH_COUNT];
+    GLuint groupFirst[STATIC_MESH_COUNT] = {};
+    GLsizei groupCount[STATIC_MESH_COUNT] = {};
+    GLsizei visibleCount[STATIC_MESH_COUNT] = {};
+
+    PFNGLMULTIDRAWELEMENTSINDIRECTPROC_LOCAL multiDrawElementsIndirect = NULL;
+
+    // appends a mesh to the merged arrays; indices are rebased so no base vertex is needed
+    void appendMesh(StaticMesh mesh, const float* vertices, size_t vertexFloats, const unsigned int* indices, size_t indexCount,
+        std::vector<float>& allVertices, std::vector<unsigned int>& allIndices)
+    {
+        unsigned int baseVertex = (unsigned int)(allVertices.size() / 8);
+        meshFirstIndex[mesh] = (GLuint)allIndices.size();
+        meshIndexCount[mesh] = (GLuint)indexCount;
+
+        // distance of the farthest vertex from the mesh origin
+        float r2 = 0.0f;
+        for (size_t v = 0; v + 2 < vertexFloats; v += 8)
+            r2 = std::max(r2, vertices[v] * vertices[v] + vertices[v + 1] * vertices[v + 1] + vertices[v + 2] * vertices[v + 2]);
+        meshRadius[mesh] = std::sqrt(r2);
+
+        allVertices.insert(allVertices.end(), vertices, vertices + vertexFloats);
+        for (size_t i = 0; i < indexCount; i++)
+            allIndices.push_back(indices[i] + baseVertex);
+    }
+
+    // one record per mesh, its instances packed at the start of the mesh's run
+    void uploadCommands()
+    {
+        if (multiDrawElementsIndirect == NULL)
+            return;
+
+        DrawElementsIndirectCommand commands[STATIC_MESH_COUNT];
+        for (int m = 0; m < STATIC_MESH_COUNT; m++)
+        {
+            commands[m].count = meshIndexCount[m];
+            commands[m].instanceCount = (GLuint)visibleCount[m];
+            commands[m].firstIndex = meshFirstIndex[m];
+            commands[m].baseVertex = 0;
+            commands[m].baseInstance = groupFirst[m];
+        }
+
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer);
+        glBufferData(GL_DRAW_INDIRECT_BUFFER, sizeof(commands), commands, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    }
+
+    void setInstanceAttribute(size_t offset)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+        // a mat4 attribute takes four consecutive locations, one per column
+        for (int column = 0; column < 4; column++)
+        {
+            glVertexAttribPointer(3 + column, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)(offset + column * sizeof(glm::vec4)));
+            glEnableVertexAttribArray(3 + column);
+            glVertexAttribDivisor(3 + column, 1);
+        }
+    }
+
+    void setUpMergedMeshes()
+    {
+        std::vector<float> allVertices;
+        std::vector<unsigned int> allIndices;
+        appendMesh(STATIC_CUBE, cube_vertices, sizeof(cube_vertices) / sizeof(float),
+            cube_indices, sizeof(cube_indices) / sizeof(unsigned int), allVertices, allIndices);
+        appendMesh(STATIC_PYRAMID, pyra_vertices, sizeof(pyra_vertices) / sizeof(float),
+            pyra_indices, sizeof(pyra_indices) / sizeof(unsigned int), allVertices, allIndices);
+        appendMesh(STATIC_HEXAGON, hexa_vertices, sizeof(hexa_vertices) / sizeof(float),
+            hexa_indices, sizeof(hexa_indices) / sizeof(unsigned int), allVertices, allIndices);
+
+        glGenVertexArrays(1, &batchVAO);
+        glGenBuffers(1, &batchVBO);
+        glGenBuffers(1, &batchEBO);
+        glGenBuffers(1, &instanceVBO);
+        glGenBuffers(1, &indirectBuffer);
+
+        glBindVertexArray(batchVAO);
+
+        glBindBuffer(GL_ARRAY_BUFFER, batchVBO);
+        glBufferData(GL_ARRAY_BUFFER, allVertices.size() * sizeof(float), allVertices.data(), GL_STATIC_DRAW);
+
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batchEBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, allIndices.size() * sizeof(unsigned int), allIndices.data(), GL_STATIC_DRAW);
+
+        // position attribute
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+
+        // vertex normal attribute
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)12);
+        glEnableVertexAttribArray(1);
+
+        // texture coordinate attribute
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)24);
+        glEnableVertexAttribArray(2);
+
+        // model matrix, one per instance
+        setInstanceAttribute(0);
+
+        glBindVertexArray(0);
+    }
+};
+
+#endif /* staticBatch_h */
@@ -23,12 +23,28 @@
 //    distribution.
 //
 //========================================================================
+//
+// The physics thread owns the particles, which are stored as one array per
+// component. Every step it splits the particles into chunks and hands them
+// to a pool of worker threads, which integrate their chunks and write them
+// into a snapshot: a flat array of position and color per particle. Idle
+// workers steal chunks from the others, so an unlucky thread never holds up
+// the step.
+//
+// There are three snapshots. The physics thread fills one while the newest
+// finished one waits to be picked up and the render thread draws the third.
+// Handing one over is a single atomic exchange of an index, so neither thread
+// ever waits for the other. The snapshot is drawn as one instanced draw of a
+// billboard quad if the context has OpenGL 3.3, otherwise with vertex arrays.
+//
+//========================================================================
 
 #if defined(_MSC_VER)
  // Make MS math.h define M_PI
  #define _USE_MATH_DEFINES
 #endif
 
+#include <stddef.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -39,6 +55,12 @@
 #include <getopt.h>
 #include <linmath.h>
 
+#if defined(_MSC_VER)
+ #include <intrin.h>
+#elif !defined(_WIN32)
+ #include <unistd.h>
+#endif
+
 #define GLAD_GL_IMPLEMENTATION
 #include <glad/gl.h>
 #define GLFW_INCLUDE_NONE
@@ -51,6 +73,17 @@
 #define GL_SEPARATE_SPECULAR_COLOR_EXT    0x81FA
 #endif // GL_EXT_separate_specular_color
 
+// The few atomic operations the job pool and the snapshot exchange need
+#if defined(_MSC_VER)
+ #define atomic_add(p, v)      _InterlockedExchangeAdd((p), (v))
+ #define atomic_exchange(p, v) _InterlockedExchange((p), (v))
+ #define atomic_load(p)        _InterlockedOr((p), 0)
+#else
+ #define atomic_add(p, v)      __atomic_fetch_add((p), (v), __ATOMIC_ACQ_REL)
+ #define atomic_exchange(p, v) __atomic_exchange_n((p), (v), __ATOMIC_ACQ_REL)
+ #define atomic_load(p)        __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#endif
+
 
 //========================================================================
 // Type definitions
@@ -75,6 +108,24 @@ typedef struct
     GLfloat x, y, z;      // Vertex coordinates
 } Vertex;
 
+// One particle as seen by the renderer. This is also the per-instance vertex
+// layout of the instanced path.
+typedef struct
+{
+    GLfloat x, y, z;      // Position
+    GLubyte rgba[4];      // Color, alpha is zero for dead particles
+} Instance;
+
+// A complete picture of the particle system at one point in time
+typedef struct
+{
+    Instance* instances;
+    int       count;
+    int       frame;      // Physics step that produced it
+    float     glow_color[4];
+    float     glow_pos[4];
+} Snapshot;
+
 
 //========================================================================
 // Program control global variables
@@ -86,17 +137,6 @@ float aspect_ratio;
 // "wireframe" flag (true if we use wireframe view)
 int wireframe;
 
-// Thread synchronization
-struct {
-    double    t;         // Time (s)
-    float     dt;        // Time since last frame (s)
-    int       p_frame;   // Particle physics frame number
-    int       d_frame;   // Particle draw frame number
-    cnd_t     p_done;    // Condition: particle physics done
-    cnd_t     d_done;    // Condition: particle draw done
-    mtx_t     particles_lock; // Particles data sharing mutex
-} thread_sync;
-
 
 //========================================================================
 // Texture declarations (we hard-code them into the source code, since
@@ -149,15 +189,12 @@ const unsigned char floor_texture[ F_TEX_WIDTH * F_TEX_HEIGHT ] = {
 // modular world, these values should be variables...
 //========================================================================
 
-// Maximum number of particles
-#define MAX_PARTICLES   3000
+// Default number of particles (see the -n option)
+#define DEFAULT_PARTICLES 3000
 
 // Life span of a particle (in seconds)
 #define LIFE_SPAN       8.f
 
-// A new particle is born every [BIRTH_INTERVAL] second
-#define BIRTH_INTERVAL (LIFE_SPAN/(float)MAX_PARTICLES)
-
 // Particle size (meters)
 #define PARTICLE_SIZE   0.7f
 
@@ -176,35 +213,52 @@ const unsigned char floor_texture[ F_TEX_WIDTH * F_TEX_HEIGHT ] = {
 // Fountain radius (m)
 #define FOUNTAIN_RADIUS 1.6f
 
-// Minimum delta-time for particle phisics (s)
-#define MIN_DELTA_T     (BIRTH_INTERVAL * 0.5f)
-
-
-//========================================================================
-// Particle system global variables
-//========================================================================
+// Maximum delta-time of one integration step for particle physics (s)
+#define MAX_DELTA_T     (1.f / 200.f)
 
-// This structure holds all state for a single particle
-typedef struct {
-    float x,y,z;     // Position in space
-    float vx,vy,vz;  // Velocity vector
-    float r,g,b;     // Color of particle
-    float life;      // Life of particle (1.0 = newborn, < 0.0 = dead)
-    int   active;    // Tells if this particle is active
-} PARTICLE;
+// Minimum time between two physics steps (s)
+#define PHYSICS_INTERVAL (1.0 / 120.0)
 
-// Global vectors holding all particles. We use two vectors for double
-// buffering.
-static PARTICLE particles[MAX_PARTICLES];
+// Longest time a single physics step may cover (s)
+#define MAX_STEP_TIME   0.1f
 
-// Global variable holding the age of the youngest particle
-static float min_age;
 
-// Color of latest born particle (used for fountain lighting)
-static float glow_color[4];
+//========================================================================
+// Particle system
+//========================================================================
 
-// Position of latest born particle (used for fountain lighting)
-static float glow_pos[4];
+// All particles, one array per component. Every particle lives for exactly
+// LIFE_SPAN seconds, so the one born longest ago is always the next one in
+// array order and births simply walk around the arrays.
+typedef struct
+{
+    int      count;
+    float*   x;          // Position in space
+    float*   y;
+    float*   z;
+    float*   vx;         // Velocity vector
+    float*   vy;
+    float*   vz;
+    float*   life;       // Life of particle (1.0 = newborn, <= 0.0 = dead)
+    GLubyte* rgb;        // Color of particle, three bytes per particle
+    int      next;       // Index of the next particle to be born
+    unsigned int born;   // Number of particles born so far
+    float    min_age;    // Age of the youngest particle
+    float    glow_color[4];  // Color of latest born particle
+    float    glow_pos[4];    // Position of latest born particle
+} ParticleSystem;
+
+static ParticleSystem particle_system;
+
+// Snapshots for the renderer and the exchange slot between the threads. The
+// slot holds the index of the newest finished snapshot, with SNAPSHOT_FRESH
+// set until the render thread has taken it.
+#define SNAPSHOT_FRESH 4
+
+static Snapshot snapshots[3];
+static volatile long snapshot_ready = 1;
+static int snapshot_write = 0;    // Only touched by the physics thread
+static int snapshot_read = 2;     // Only touched by the render thread
 
 
 //========================================================================
@@ -226,11 +280,15 @@ const GLfloat fog_color[4]         = { 0.1f, 0.1f, 0.1f, 1.f };
 
 static void usage(void)
 {
-    printf("Usage: particles [-bfhs]\n");
+    printf("Usage: particles [-bfhs] [-n COUNT] [-t THREADS]\n");
     printf("Options:\n");
+    printf(" -b   Benchmark the physics from 10k to 10M particles and exit\n");
     printf(" -f   Run in full screen\n");
     printf(" -h   Display this help\n");
-    printf(" -s   Run program as single thread (default is to use two threads)\n");
+    printf(" -n   Number of particles (default is %i)\n", DEFAULT_PARTICLES);
+    printf(" -s   Run program as single thread (default is to use a physics thread\n");
+    printf("      and a pool of workers)\n");
+    printf(" -t   Number of physics threads (default is one less than the CPU count)\n");
     printf("\n");
     printf("Program runtime controls:\n");
     printf(" W    Toggle wireframe mode\n");
@@ -238,152 +296,719 @@ static void usage(void)
 }
 
 
+//========================================================================
+// Job pool
+//========================================================================
+
+#define MAX_THREADS 64
+
+// Number of particles handed out at a time
+#define CHUNK_PARTICLES 4096
+
+typedef void (*JobFunc)(void* data, int begin, int end);
+
+// The chunks of the current job a thread starts out with. Other threads
+// steal from the same counter once their own range is exhausted.
+typedef struct
+{
+    volatile long next;   // Next chunk to run
+    long          end;    // One past the last chunk
+    char          pad[64 - 2 * sizeof(long)]; // Keep counters on separate cache lines
+} JobRange;
+
+typedef struct JobPool JobPool;
+
+typedef struct
+{
+    JobPool* pool;
+    int      index;
+} JobWorker;
+
+struct JobPool
+{
+    int           thread_count;   // Workers plus the thread calling run_job
+    thrd_t        threads[MAX_THREADS];
+    JobWorker     workers[MAX_THREADS];
+    mtx_t         lock;
+    cnd_t         wake;
+    int           generation;     // Bumped for every job
+    int           quit;
+    JobFunc       func;
+    void*         data;
+    int           items;
+    int           chunk_size;
+    JobRange      ranges[MAX_THREADS];
+    volatile long pending;        // Chunks not yet finished
+    volatile long busy;           // Workers inside a job
+};
+
+static JobPool job_pool;
+
+static void run_chunks(JobPool* pool, int index)
+{
+    int i;
+
+    // Drain our own range first, then steal from the others in turn
+    for (i = 0;  i < pool->thread_count;  i++)
+    {
+        JobRange* range = pool->ranges + (index + i) % pool->thread_count;
+
+        for (;;)
+        {
+            const long chunk = atomic_add(&range->next, 1);
+            int begin, end;
+
+            if (chunk >= range->end)
+                break;
+
+            begin = (int) chunk * pool->chunk_size;
+            end = begin + pool->chunk_size;
+            if (end > pool->items)
+                end = pool->items;
+
+            pool->func(pool->data, begin, end);
+            atomic_add(&pool->pending, -1);
+        }
+    }
+}
+
+static int worker_main(void* arg)
+{
+    JobWorker* worker = arg;
+    JobPool* pool = worker->pool;
+    int generation = 0;
+
+    for (;;)
+    {
+        mtx_lock(&pool->lock);
+        while (!pool->quit && pool->generation == generation)
+            cnd_wait(&pool->wake, &pool->lock);
+
+        if (pool->quit)
+        {
+            mtx_unlock(&pool->lock);
+            break;
+        }
+
+        // Joining under the lock keeps run_job from setting up the next job
+        // while this thread still looks at the ranges of the current one
+        generation = pool->generation;
+        atomic_add(&pool->busy, 1);
+        mtx_unlock(&pool->lock);
+
+        run_chunks(pool, worker->index);
+        atomic_add(&pool->busy, -1);
+    }
+
+    return 0;
+}
+
+static int create_job_pool(JobPool* pool, int thread_count)
+{
+    int i;
+
+    memset(pool, 0, sizeof(JobPool));
+    pool->thread_count = thread_count < 1 ? 1 :
+                         thread_count > MAX_THREADS ? MAX_THREADS : thread_count;
+
+    mtx_init(&pool->lock, mtx_plain);
+    cnd_init(&pool->wake);
+
+    // The thread calling run_job is worker zero
+    for (i = 1;  i < pool->thread_count;  i++)
+    {
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i;
+        if (thrd_create(&pool->threads[i], worker_main, &pool->workers[i]) != thrd_success)
+        {
+            pool->thread_count = i;
+            break;
+        }
+    }
+
+    return pool->thread_count;
+}
+
+// The bundled tinycthread implements cnd_broadcast as pthread_cond_signal on
+// POSIX, which wakes a single waiter, so every worker gets a signal of its own
+static void wake_workers(JobPool* pool)
+{
+    int i;
+
+    for (i = 1;  i < pool->thread_count;  i++)
+        cnd_signal(&pool->wake);
+}
+
+static void destroy_job_pool(JobPool* pool)
+{
+    int i;
+
+    mtx_lock(&pool->lock);
+    pool->quit = 1;
+    wake_workers(pool);
+    mtx_unlock(&pool->lock);
+
+    for (i = 1;  i < pool->thread_count;  i++)
+        thrd_join(pool->threads[i], NULL);
+
+    cnd_destroy(&pool->wake);
+    mtx_destroy(&pool->lock);
+}
+
+// Calls func for every chunk of [0, items) and returns once all are done
+static void run_job(JobPool* pool, JobFunc func, void* data, int items, int chunk_size)
+{
+    const long chunks = (items + chunk_size - 1) / chunk_size;
+    long i;
+
+    if (chunks == 0)
+        return;
+
+    if (pool->thread_count == 1 || chunks == 1)
+    {
+        func(data, 0, items);
+        return;
+    }
+
+    mtx_lock(&pool->lock);
+
+    // A worker may still be leaving the previous job
+    while (atomic_load(&pool->busy) > 0)
+        thrd_yield();
+
+    pool->func = func;
+    pool->data = data;
+    pool->items = items;
+    pool->chunk_size = chunk_size;
+
+    for (i = 0;  i < pool->thread_count;  i++)
+    {
+        pool->ranges[i].next = chunks * i / pool->thread_count;
+        pool->ranges[i].end = chunks * (i + 1) / pool->thread_count;
+    }
+
+    atomic_exchange(&pool->pending, chunks);
+    pool->generation++;
+    wake_workers(pool);
+    mtx_unlock(&pool->lock);
+
+    run_chunks(pool, 0);
+
+    // Whatever is left is being run by someone else, so this is short
+    while (atomic_load(&pool->pending) > 0)
+        thrd_yield();
+}
+
+// Returns the number of processors available to this process
+static int get_cpu_count(void)
+{
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int) info.dwNumberOfProcessors;
+#elif defined(_SC_NPROCESSORS_ONLN)
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int) count : 1;
+#else
+    return 1;
+#endif
+}
+
+
+//========================================================================
+// Allocate and free particle storage
+//========================================================================
+
+static void destroy_particle_system(ParticleSystem* s)
+{
+    free(s->x);
+    free(s->y);
+    free(s->z);
+    free(s->vx);
+    free(s->vy);
+    free(s->vz);
+    free(s->life);
+    free(s->rgb);
+    memset(s, 0, sizeof(ParticleSystem));
+}
+
+static int create_particle_system(ParticleSystem* s, int count)
+{
+    const size_t size = (size_t) count * sizeof(float);
+
+    memset(s, 0, sizeof(ParticleSystem));
+    s->count = count;
+    s->x = malloc(size);
+    s->y = malloc(size);
+    s->z = malloc(size);
+    s->vx = malloc(size);
+    s->vy = malloc(size);
+    s->vz = malloc(size);
+    s->life = calloc(count, sizeof(float));
+    s->rgb = malloc((size_t) count * 3);
+
+    if (!s->x || !s->y || !s->z || !s->vx || !s->vy || !s->vz ||
+        !s->life || !s->rgb)
+    {
+        destroy_particle_system(s);
+        return 0;
+    }
+
+    return 1;
+}
+
+static void destroy_snapshot(Snapshot* snapshot)
+{
+    free(snapshot->instances);
+    memset(snapshot, 0, sizeof(Snapshot));
+}
+
+static int create_snapshot(Snapshot* snapshot, int count)
+{
+    memset(snapshot, 0, sizeof(Snapshot));
+    snapshot->instances = calloc(count, sizeof(Instance));
+    if (!snapshot->instances)
+        return 0;
+
+    snapshot->count = count;
+    snapshot->frame = -1;
+    return 1;
+}
+
+
 //========================================================================
 // Initialize a new particle
 //========================================================================
 
-static void init_particle(PARTICLE *p, double t)
+// Turns the birth number of a particle into random bits. The physics runs on
+// several threads, so rand() is out.
+static unsigned int hash_birth(unsigned int n)
+{
+    n ^= n >> 16;
+    n *= 0x7feb352dU;
+    n ^= n >> 15;
+    n *= 0x846ca68bU;
+    n ^= n >> 16;
+    return n;
+}
+
+static void init_particle(ParticleSystem* s, int i, unsigned int birth, double t)
 {
+    const unsigned int bits = hash_birth(birth);
     float xy_angle, velocity;
 
     // Start position of particle is at the fountain blow-out
-    p->x = 0.f;
-    p->y = 0.f;
-    p->z = FOUNTAIN_HEIGHT;
+    s->x[i] = 0.f;
+    s->y[i] = 0.f;
+    s->z[i] = FOUNTAIN_HEIGHT;
 
     // Start velocity is up (Z)...
-    p->vz = 0.7f + (0.3f / 4096.f) * (float) (rand() & 4095);
+    s->vz[i] = 0.7f + (0.3f / 4096.f) * (float) (bits & 4095);
 
     // ...and a randomly chosen X/Y direction
-    xy_angle = (2.f * (float) M_PI / 4096.f) * (float) (rand() & 4095);
-    p->vx = 0.4f * (float) cos(xy_angle);
-    p->vy = 0.4f * (float) sin(xy_angle);
+    xy_angle = (2.f * (float) M_PI / 4096.f) * (float) ((bits >> 12) & 4095);
+    s->vx[i] = 0.4f * (float) cos(xy_angle);
+    s->vy[i] = 0.4f * (float) sin(xy_angle);
 
     // Scale velocity vector according to a time-varying velocity
     velocity = VELOCITY * (0.8f + 0.1f * (float) (sin(0.5 * t) + sin(1.31 * t)));
-    p->vx *= velocity;
-    p->vy *= velocity;
-    p->vz *= velocity;
+    s->vx[i] *= velocity;
+    s->vy[i] *= velocity;
+    s->vz[i] *= velocity;
 
     // Color is time-varying
-    p->r = 0.7f + 0.3f * (float) sin(0.34 * t + 0.1);
-    p->g = 0.6f + 0.4f * (float) sin(0.63 * t + 1.1);
-    p->b = 0.6f + 0.4f * (float) sin(0.91 * t + 2.1);
-
-    // Store settings for fountain glow lighting
-    glow_pos[0] = 0.4f * (float) sin(1.34 * t);
-    glow_pos[1] = 0.4f * (float) sin(3.11 * t);
-    glow_pos[2] = FOUNTAIN_HEIGHT + 1.f;
-    glow_pos[3] = 1.f;
-    glow_color[0] = p->r;
-    glow_color[1] = p->g;
-    glow_color[2] = p->b;
-    glow_color[3] = 1.f;
-
-    // The particle is new-born and active
-    p->life = 1.f;
-    p->active = 1;
+    s->rgb[i * 3 + 0] = (GLubyte) (255.f * (0.7f + 0.3f * (float) sin(0.34 * t + 0.1)));
+    s->rgb[i * 3 + 1] = (GLubyte) (255.f * (0.6f + 0.4f * (float) sin(0.63 * t + 1.1)));
+    s->rgb[i * 3 + 2] = (GLubyte) (255.f * (0.6f + 0.4f * (float) sin(0.91 * t + 2.1)));
+
+    // The particle is new-born
+    s->life[i] = 1.f;
 }
 
 
 //========================================================================
-// Update a particle
+// Update a range of particles
 //========================================================================
 
 #define FOUNTAIN_R2 (FOUNTAIN_RADIUS+PARTICLE_SIZE/2)*(FOUNTAIN_RADIUS+PARTICLE_SIZE/2)
 
-static void update_particle(PARTICLE *p, float dt)
+static void update_particles(ParticleSystem* s, int begin, int end, float dt)
 {
-    // If the particle is not active, we need not do anything
-    if (!p->active)
-        return;
+    float* x = s->x;
+    float* y = s->y;
+    float* z = s->z;
+    float* vz = s->vz;
+    float* life = s->life;
+    const float* vx = s->vx;
+    const float* vy = s->vy;
+    int i;
 
-    // The particle is getting older...
-    p->life -= dt * (1.f / LIFE_SPAN);
+    // Dead particles are moved as well. They are invisible, and without
+    // branches in the loop the compiler can vectorize it.
+    for (i = begin;  i < end;  i++)
+    {
+        float px, py, pz, pvz, level;
+        int falling, on_fountain, bounce;
+
+        // The particle is getting older...
+        life[i] -= dt * (1.f / LIFE_SPAN);
+
+        // Apply gravity
+        pvz = vz[i] - GRAVITY * dt;
+
+        // Update particle position
+        px = x[i] + vx[i] * dt;
+        py = y[i] + vy[i] * dt;
+        pz = z[i] + pvz * dt;
+
+        // Simple collision detection + response. Particles should bounce on
+        // the fountain if above it and otherwise on the floor (with friction).
+        falling = pvz < 0.f;
+        on_fountain = (px * px + py * py) < FOUNTAIN_R2;
+        level = on_fountain ? FOUNTAIN_HEIGHT + PARTICLE_SIZE / 2 : PARTICLE_SIZE / 2;
+        bounce = falling & (pz < level);
+
+        x[i] = px;
+        y[i] = py;
+        z[i] = bounce ? level + FRICTION * (level - pz) : pz;
+        vz[i] = bounce ? -FRICTION * pvz : pvz;
+    }
+}
 
-    // Did the particle die?
-    if (p->life <= 0.f)
+// Integrates a range over dt in steps of at most MAX_DELTA_T. Doing all steps
+// for one chunk before moving on keeps the chunk in the cache.
+static void advance_particles(ParticleSystem* s, int begin, int end, float dt)
+{
+    while (dt > 0.f)
     {
-        p->active = 0;
-        return;
+        const float dt2 = dt < MAX_DELTA_T ? dt : MAX_DELTA_T;
+        update_particles(s, begin, end, dt2);
+        dt -= dt2;
     }
+}
 
-    // Apply gravity
-    p->vz = p->vz - GRAVITY * dt;
+// Copies a range of particles into a snapshot
+static void pack_particles(const ParticleSystem* s, Snapshot* snapshot, int begin, int end)
+{
+    int i;
 
-    // Update particle position
-    p->x = p->x + p->vx * dt;
-    p->y = p->y + p->vy * dt;
-    p->z = p->z + p->vz * dt;
+    for (i = begin;  i < end;  i++)
+    {
+        Instance* instance = snapshot->instances + i;
+
+        // Calculate particle intensity (we set it to max during 75%
+        // of its life, then it fades out)
+        float alpha = 4.f * s->life[i];
+        if (alpha > 1.f)
+            alpha = 1.f;
+        else if (alpha < 0.f)
+            alpha = 0.f;
+
+        instance->x = s->x[i];
+        instance->y = s->y[i];
+        instance->z = s->z[i];
+        instance->rgba[0] = s->rgb[i * 3 + 0];
+        instance->rgba[1] = s->rgb[i * 3 + 1];
+        instance->rgba[2] = s->rgb[i * 3 + 2];
+        instance->rgba[3] = (GLubyte) (alpha * 255.f);
+    }
+}
 
-    // Simple collision detection + response
-    if (p->vz < 0.f)
+
+//========================================================================
+// The main frame for the particle engine. Called once per physics step.
+//========================================================================
+
+typedef struct
+{
+    ParticleSystem* system;
+    Snapshot*       snapshot;
+    float           dt;
+} UpdateJob;
+
+typedef struct
+{
+    ParticleSystem* system;
+    Snapshot*       snapshot;
+    double          t_end;     // Time at the end of the step
+    float           age;       // Age of the first particle born this step
+    float           interval;  // Time between two births
+} BirthJob;
+
+static void update_job(void* data, int begin, int end)
+{
+    const UpdateJob* job = data;
+    advance_particles(job->system, begin, end, job->dt);
+    pack_particles(job->system, job->snapshot, begin, end);
+}
+
+static void birth_job(void* data, int begin, int end)
+{
+    const BirthJob* job = data;
+    ParticleSystem* s = job->system;
+    int k;
+
+    for (k = begin;  k < end;  k++)
     {
-        // Particles should bounce on the fountain (with friction)
-        if ((p->x * p->x + p->y * p->y) < FOUNTAIN_R2 &&
-            p->z < (FOUNTAIN_HEIGHT + PARTICLE_SIZE / 2))
-        {
-            p->vz = -FRICTION * p->vz;
-            p->z  = FOUNTAIN_HEIGHT + PARTICLE_SIZE / 2 +
-                    FRICTION * (FOUNTAIN_HEIGHT +
-                    PARTICLE_SIZE / 2 - p->z);
-        }
+        const int i = (s->next + k) % s->count;
+        const float age = job->age - (float) k * job->interval;
 
-        // Particles should bounce on the floor (with friction)
-        else if (p->z < PARTICLE_SIZE / 2)
-        {
-            p->vz = -FRICTION * p->vz;
-            p->z  = PARTICLE_SIZE / 2 +
-                    FRICTION * (PARTICLE_SIZE / 2 - p->z);
-        }
+        init_particle(s, i, s->born + (unsigned int) k, job->t_end - age);
+        advance_particles(s, i, i + 1, age);
+        pack_particles(s, job->snapshot, i, i + 1);
+    }
+}
+
+static void particle_engine(ParticleSystem* s, JobPool* pool, Snapshot* snapshot,
+                            double t, float dt)
+{
+    const float interval = LIFE_SPAN / (float) s->count;
+    UpdateJob update = { s, snapshot, dt };
+    int births;
+
+    // Move every living particle
+    run_job(pool, update_job, &update, s->count, CHUNK_PARTICLES);
+
+    // Should we create any new particle(s)? They replace the oldest ones,
+    // which is why they are born after everything else has moved.
+    s->min_age += dt;
+    births = (int) (s->min_age / interval);
+    if (births > s->count)
+    {
+        s->min_age -= (float) (births - s->count) * interval;
+        births = s->count;
+    }
+
+    if (births > 0)
+    {
+        BirthJob birth = { s, snapshot, t + dt, s->min_age - interval, interval };
+        const float age = birth.age - (float) (births - 1) * interval;
+        const double t_born = t + dt - age;
+        const int last = (s->next + births - 1) % s->count;
+
+        run_job(pool, birth_job, &birth, births, CHUNK_PARTICLES);
+
+        // Store settings for fountain glow lighting
+        s->glow_pos[0] = 0.4f * (float) sin(1.34 * t_born);
+        s->glow_pos[1] = 0.4f * (float) sin(3.11 * t_born);
+        s->glow_pos[2] = FOUNTAIN_HEIGHT + 1.f;
+        s->glow_pos[3] = 1.f;
+        s->glow_color[0] = s->rgb[last * 3 + 0] / 255.f;
+        s->glow_color[1] = s->rgb[last * 3 + 1] / 255.f;
+        s->glow_color[2] = s->rgb[last * 3 + 2] / 255.f;
+        s->glow_color[3] = 1.f;
+
+        s->min_age -= (float) births * interval;
+        s->next = (s->next + births) % s->count;
+        s->born += (unsigned int) births;
     }
+
+    memcpy(snapshot->glow_color, s->glow_color, sizeof(s->glow_color));
+    memcpy(snapshot->glow_pos, s->glow_pos, sizeof(s->glow_pos));
+    snapshot->frame++;
 }
 
 
 //========================================================================
-// The main frame for the particle engine. Called once per frame.
+// Hand snapshots between the physics and the render thread
 //========================================================================
 
-static void particle_engine(double t, float dt)
+// Makes the snapshot just written the newest one and returns the next one to
+// write, which is whichever the render thread is not holding
+static Snapshot* publish_snapshot(void)
 {
-    int i;
-    float dt2;
+    const int frame = snapshots[snapshot_write].frame;
 
-    // Update particles (iterated several times per frame if dt is too large)
-    while (dt > 0.f)
+    snapshot_write = (int) atomic_exchange(&snapshot_ready,
+                                           snapshot_write | SNAPSHOT_FRESH) & 3;
+
+    // Frame numbers keep increasing across the buffers
+    snapshots[snapshot_write].frame = frame;
+    return snapshots + snapshot_write;
+}
+
+// Returns the newest snapshot; never waits for the physics thread
+static const Snapshot* acquire_snapshot(void)
+{
+    if (atomic_load(&snapshot_ready) & SNAPSHOT_FRESH)
+        snapshot_read = (int) atomic_exchange(&snapshot_ready, snapshot_read) & 3;
+
+    return snapshots + snapshot_read;
+}
+
+
+//========================================================================
+// Instanced particle drawing (OpenGL 3.3)
+//========================================================================
+
+static const char* particle_vertex_shader_text =
+"#version 110\n"
+"uniform vec3 right;\n"
+"uniform vec3 up;\n"
+"attribute vec2 corner;\n"
+"attribute vec3 center;\n"
+"attribute vec4 color;\n"
+"varying vec2 texcoord;\n"
+"varying vec4 tint;\n"
+"void main()\n"
+"{\n"
+"    texcoord = corner * 0.5 + 0.5;\n"
+"    tint = color;\n"
+"    if (color.a == 0.0)\n"
+"        gl_Position = vec4(2.0, 2.0, 2.0, 1.0);\n"
+"    else\n"
+"        gl_Position = gl_ModelViewProjectionMatrix *\n"
+"                      vec4(center + corner.x * right + corner.y * up, 1.0);\n"
+"}\n";
+
+static const char* particle_fragment_shader_text =
+"#version 110\n"
+"uniform sampler2D spot;\n"
+"uniform bool textured;\n"
+"varying vec2 texcoord;\n"
+"varying vec4 tint;\n"
+"void main()\n"
+"{\n"
+"    float l = textured ? texture2D(spot, texcoord).r : 1.0;\n"
+"    gl_FragColor = vec4(tint.rgb * l, tint.a);\n"
+"}\n";
+
+// Corners of the billboard as a triangle strip, in units of half its size
+static const GLfloat particle_corners[8] =
+{
+    -1.f, -1.f,  1.f, -1.f,  -1.f, 1.f,  1.f, 1.f
+};
+
+static GLuint particle_program;
+static GLint right_location, up_location, textured_location;
+static GLuint corner_buffer, instance_buffer;
+static int uploaded_frame = -1;
+
+static GLuint compile_shader(GLenum type, const char* text)
+{
+    GLint status;
+    const GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &text, NULL);
+    glCompileShader(shader);
+
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (!status)
     {
-        // Calculate delta time for this iteration
-        dt2 = dt < MIN_DELTA_T ? dt : MIN_DELTA_T;
+        char log[1024];
+        glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+        fprintf(stderr, "Failed to compile particle shader: %s\n", log);
+        glDeleteShader(shader);
+        return 0;
+    }
 
-        for (i = 0;  i < MAX_PARTICLES;  i++)
-            update_particle(&particles[i], dt2);
+    return shader;
+}
 
-        min_age += dt2;
+// Sets up the instanced path, leaving particle_program zero if the context
+// cannot do it
+static void init_instancing(void)
+{
+    GLuint vertex_shader, fragment_shader;
+    GLint status;
 
-        // Should we create any new particle(s)?
-        while (min_age >= BIRTH_INTERVAL)
-        {
-            min_age -= BIRTH_INTERVAL;
+    if (!GLAD_GL_VERSION_3_3)
+        return;
 
-            // Find a dead particle to replace with a new one
-            for (i = 0;  i < MAX_PARTICLES;  i++)
-            {
-                if (!particles[i].active)
-                {
-                    init_particle(&particles[i], t + min_age);
-                    update_particle(&particles[i], min_age);
-                    break;
-                }
-            }
-        }
+    vertex_shader = compile_shader(GL_VERTEX_SHADER, particle_vertex_shader_text);
+    fragment_shader = compile_shader(GL_FRAGMENT_SHADER, particle_fragment_shader_text);
+    if (!vertex_shader || !fragment_shader)
+        return;
 
-        dt -= dt2;
+    particle_program = glCreateProgram();
+    glAttachShader(particle_program, vertex_shader);
+    glAttachShader(particle_program, fragment_shader);
+    glBindAttribLocation(particle_program, 0, "corner");
+    glBindAttribLocation(particle_program, 1, "center");
+    glBindAttribLocation(particle_program, 2, "color");
+    glLinkProgram(particle_program);
+    glDeleteShader(vertex_shader);
+    glDeleteShader(fragment_shader);
+
+    glGetProgramiv(particle_program, GL_LINK_STATUS, &status);
+    if (!status)
+    {
+        fprintf(stderr, "Failed to link particle shader\n");
+        glDeleteProgram(particle_program);
+        particle_program = 0;
+        return;
     }
+
+    right_location = glGetUniformLocation(particle_program, "right");
+    up_location = glGetUniformLocation(particle_program, "up");
+    textured_location = glGetUniformLocation(particle_program, "textured");
+
+    glUseProgram(particle_program);
+    glUniform1i(glGetUniformLocation(particle_program, "spot"), 0);
+    glUseProgram(0);
+
+    glGenBuffers(1, &corner_buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, corner_buffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(particle_corners), particle_corners, GL_STATIC_DRAW);
+
+    glGenBuffers(1, &instance_buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+static void draw_particles_instanced(const Snapshot* snapshot, const GLfloat* mat)
+{
+    glUseProgram(particle_program);
+
+    // The billboard axes are the first two rows of the modelview rotation,
+    // i.e. the view plane's right and up directions in world space
+    glUniform3f(right_location,
+                (PARTICLE_SIZE / 2) * mat[0],
+                (PARTICLE_SIZE / 2) * mat[4],
+                (PARTICLE_SIZE / 2) * mat[8]);
+    glUniform3f(up_location,
+                (PARTICLE_SIZE / 2) * mat[1],
+                (PARTICLE_SIZE / 2) * mat[5],
+                (PARTICLE_SIZE / 2) * mat[9]);
+    glUniform1i(textured_location, !wireframe);
+
+    glBindBuffer(GL_ARRAY_BUFFER, instance_buffer);
+
+    // The physics may run slower than the display; only upload new snapshots,
+    // and orphan the old storage so the upload never waits on the last draw
+    if (snapshot->frame != uploaded_frame)
+    {
+        const GLsizeiptr size = (GLsizeiptr) snapshot->count * sizeof(Instance);
+        glBufferData(GL_ARRAY_BUFFER, size, NULL, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, size, snapshot->instances);
+        uploaded_frame = snapshot->frame;
+    }
+
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Instance),
+                          (void*) offsetof(Instance, x));
+    glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Instance),
+                          (void*) offsetof(Instance, rgba));
+    glVertexAttribDivisor(1, 1);
+    glVertexAttribDivisor(2, 1);
+    glEnableVertexAttribArray(1);
+    glEnableVertexAttribArray(2);
+
+    glBindBuffer(GL_ARRAY_BUFFER, corner_buffer);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, (void*) 0);
+    glEnableVertexAttribArray(0);
+
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, snapshot->count);
+
+    glDisableVertexAttribArray(0);
+    glDisableVertexAttribArray(1);
+    glDisableVertexAttribArray(2);
+    glVertexAttribDivisor(1, 0);
+    glVertexAttribDivisor(2, 0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glUseProgram(0);
 }
 
 
 //========================================================================
-// Draw all active particles. We use OpenGL 1.1 vertex
+// Draw all living particles. Without OpenGL 3.3 we use OpenGL 1.1 vertex
 // arrays for this in order to accelerate the drawing.
 //========================================================================
 
@@ -392,16 +1017,19 @@ static void particle_engine(double t, float dt)
                             // the L1 data cache on most CPUs)
 #define PARTICLE_VERTS  4   // Number of vertices per particle
 
-static void draw_particles(GLFWwindow* window, double t, float dt)
+static void draw_particles(const Snapshot* snapshot)
 {
     int i, particle_count;
     Vertex vertex_array[BATCH_PARTICLES * PARTICLE_VERTS];
     Vertex* vptr;
-    float alpha;
     GLuint rgba;
     Vec3 quad_lower_left, quad_lower_right;
     GLfloat mat[16];
-    PARTICLE* pptr;
+    const Instance* pptr;
+
+    // Nothing to draw until the physics has finished its first step
+    if (snapshot->frame < 0)
+        return;
 
     // Here comes the real trick with flat single primitive objects (s.c.
     // "billboards"): We must rotate the textured primitive so that it
@@ -416,6 +1044,31 @@ static void draw_particles(GLFWwindow* window, double t, float dt)
     // the matrix, which represents the rotation.
     glGetFloatv(GL_MODELVIEW_MATRIX, mat);
 
+    // Don't update z-buffer, since all particles are transparent!
+    glDepthMask(GL_FALSE);
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+
+    // Select particle texture
+    if (!wireframe)
+    {
+        glEnable(GL_TEXTURE_2D);
+        glBindTexture(GL_TEXTURE_2D, particle_tex_id);
+    }
+
+    if (particle_program)
+    {
+        // The vertex shader does 1) to 3) for every instance
+        draw_particles_instanced(snapshot, mat);
+
+        glDisable(GL_TEXTURE_2D);
+        glDisable(GL_BLEND);
+
+        glDepthMask(GL_TRUE);
+        return;
+    }
+
     // 1) & 2) We do it in one swift step:
     // Although not obvious, the following six lines represent two matrix/
     // vector multiplications. The matrix is the inverse 3x3 rotation
@@ -431,19 +1084,6 @@ static void draw_particles(GLFWwindow* window, double t, float dt)
     quad_lower_right.y = (PARTICLE_SIZE / 2) * (mat[4] - mat[5]);
     quad_lower_right.z = (PARTICLE_SIZE / 2) * (mat[8] - mat[9]);
 
-    // Don't update z-buffer, since all particles are transparent!
-    glDepthMask(GL_FALSE);
-
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE);
-
-    // Select particle texture
-    if (!wireframe)
-    {
-        glEnable(GL_TEXTURE_2D);
-        glBindTexture(GL_TEXTURE_2D, particle_tex_id);
-    }
-
     // Set up vertex arrays. We use interleaved arrays, which is easier to
     // handle (in most situations) and it gives a linear memory access
     // access pattern (which may give better performance in some
@@ -452,47 +1092,16 @@ static void draw_particles(GLFWwindow* window, double t, float dt)
     // Most OpenGL cards / drivers are optimized for this format.
     glInterleavedArrays(GL_T2F_C4UB_V3F, 0, vertex_array);
 
-    // Wait for particle physics thread to be done
-    mtx_lock(&thread_sync.particles_lock);
-    while (!glfwWindowShouldClose(window) &&
-            thread_sync.p_frame <= thread_sync.d_frame)
-    {
-        struct timespec ts;
-        clock_gettime(CLOCK_REALTIME, &ts);
-        ts.tv_nsec += 100 * 1000 * 1000;
-        ts.tv_sec += ts.tv_nsec / (1000 * 1000 * 1000);
-        ts.tv_nsec %= 1000 * 1000 * 1000;
-        cnd_timedwait(&thread_sync.p_done, &thread_sync.particles_lock, &ts);
-    }
-
-    // Store the frame time and delta time for the physics thread
-    thread_sync.t = t;
-    thread_sync.dt = dt;
-
-    // Update frame counter
-    thread_sync.d_frame++;
-
     // Loop through all particles and build vertex arrays.
     particle_count = 0;
     vptr = vertex_array;
-    pptr = particles;
+    pptr = snapshot->instances;
 
-    for (i = 0;  i < MAX_PARTICLES;  i++)
+    for (i = 0;  i < snapshot->count;  i++)
     {
-        if (pptr->active)
+        if (pptr->rgba[3])
         {
-            // Calculate particle intensity (we set it to max during 75%
-            // of its life, then it fades out)
-            alpha =  4.f * pptr->life;
-            if (alpha > 1.f)
-                alpha = 1.f;
-
-            // Convert color from float to 8-bit (store it in a 32-bit
-            // integer using endian independent type casting)
-            ((GLubyte*) &rgba)[0] = (GLubyte)(pptr->r * 255.f);
-            ((GLubyte*) &rgba)[1] = (GLubyte)(pptr->g * 255.f);
-            ((GLubyte*) &rgba)[2] = (GLubyte)(pptr->b * 255.f);
-            ((GLubyte*) &rgba)[3] = (GLubyte)(alpha * 255.f);
+            memcpy(&rgba, pptr->rgba, sizeof(rgba));
 
             // 3) Translate the quad to the correct position in modelview
             // space and store its parameters in vertex arrays (we also
@@ -554,10 +1163,6 @@ static void draw_particles(GLFWwindow* window, double t, float dt)
         pptr++;
     }
 
-    // We are done with the particle data
-    mtx_unlock(&thread_sync.particles_lock);
-    cnd_signal(&thread_sync.d_done);
-
     // Draw final batch of particles (if any)
     glDrawArrays(GL_QUADS, 0, PARTICLE_VERTS * particle_count);
 
@@ -746,7 +1351,7 @@ static void draw_floor(void)
 // Position and configure light sources
 //========================================================================
 
-static void setup_lights(void)
+static void setup_lights(const Snapshot* snapshot)
 {
     float l1pos[4], l1amb[4], l1dif[4], l1spec[4];
     float l2pos[4], l2amb[4], l2dif[4], l2spec[4];
@@ -771,9 +1376,9 @@ static void setup_lights(void)
     glLightfv(GL_LIGHT2, GL_AMBIENT, l2amb);
     glLightfv(GL_LIGHT2, GL_DIFFUSE, l2dif);
     glLightfv(GL_LIGHT2, GL_SPECULAR, l2spec);
-    glLightfv(GL_LIGHT3, GL_POSITION, glow_pos);
-    glLightfv(GL_LIGHT3, GL_DIFFUSE, glow_color);
-    glLightfv(GL_LIGHT3, GL_SPECULAR, glow_color);
+    glLightfv(GL_LIGHT3, GL_POSITION, snapshot->glow_pos);
+    glLightfv(GL_LIGHT3, GL_DIFFUSE, snapshot->glow_color);
+    glLightfv(GL_LIGHT3, GL_SPECULAR, snapshot->glow_color);
 
     glEnable(GL_LIGHT1);
     glEnable(GL_LIGHT2);
@@ -788,13 +1393,10 @@ static void setup_lights(void)
 static void draw_scene(GLFWwindow* window, double t)
 {
     double xpos, ypos, zpos, angle_x, angle_y, angle_z;
-    static double t_old = 0.0;
-    float dt;
     mat4x4 projection;
 
-    // Calculate frame-to-frame delta time
-    dt = (float) (t - t_old);
-    t_old = t;
+    // Pick up the newest particle state, whichever step it is from
+    const Snapshot* snapshot = acquire_snapshot();
 
     mat4x4_perspective(projection,
                        65.f * (float) M_PI / 180.f,
@@ -831,7 +1433,7 @@ static void draw_scene(GLFWwindow* window, double t)
     glCullFace(GL_BACK);
     glEnable(GL_CULL_FACE);
 
-    setup_lights();
+    setup_lights(snapshot);
     glEnable(GL_LIGHTING);
 
     glEnable(GL_FOG);
@@ -851,7 +1453,7 @@ static void draw_scene(GLFWwindow* window, double t)
     glDisable(GL_FOG);
 
     // Particles must be drawn after all solid objects have been drawn
-    draw_particles(window, t, dt);
+    draw_particles(snapshot);
 
     // Z-buffer not needed anymore
     glDisable(GL_DEPTH_TEST);
@@ -901,38 +1503,113 @@ static void key_callback(GLFWwindow* window, int key, int scancode, int action,
 static int physics_thread_main(void* arg)
 {
     GLFWwindow* window = arg;
+    Snapshot* snapshot = snapshots + snapshot_write;
+    double t_old = glfwGetTime();
 
-    for (;;)
+    while (!glfwWindowShouldClose(window))
     {
-        mtx_lock(&thread_sync.particles_lock);
+        const double t = glfwGetTime();
+        float dt = (float) (t - t_old);
 
-        // Wait for particle drawing to be done
-        while (!glfwWindowShouldClose(window) &&
-               thread_sync.p_frame > thread_sync.d_frame)
+        // Don't step more often than the display can show it
+        if (t - t_old < PHYSICS_INTERVAL)
         {
             struct timespec ts;
+            const long wait = (long) ((PHYSICS_INTERVAL - (t - t_old)) * 1e9);
             clock_gettime(CLOCK_REALTIME, &ts);
-            ts.tv_nsec += 100 * 1000 * 1000;
+            ts.tv_nsec += wait;
             ts.tv_sec += ts.tv_nsec / (1000 * 1000 * 1000);
             ts.tv_nsec %= 1000 * 1000 * 1000;
-            cnd_timedwait(&thread_sync.d_done, &thread_sync.particles_lock, &ts);
+            thrd_sleep(&ts, NULL);
+            continue;
         }
 
-        if (glfwWindowShouldClose(window))
+        // If we fell far behind, the particles just move slower for a while
+        if (dt > MAX_STEP_TIME)
+            dt = MAX_STEP_TIME;
+
+        particle_engine(&particle_system, &job_pool, snapshot, t_old, dt);
+        snapshot = publish_snapshot();
+        t_old = t;
+    }
+
+    return 0;
+}
+
+
+//========================================================================
+// Benchmark the physics, without a window
+//========================================================================
+
+static double get_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+static void benchmark(int max_threads)
+{
+    const int counts[] = { 10000, 100000, 1000000, 10000000 };
+    const float dt = 1.f / 60.f;
+    int i, j, threads;
+
+    printf("%10s %8s %12s %12s %8s\n",
+           "particles", "threads", "ms/step", "ns/particle", "speedup");
+
+    for (i = 0;  i < (int) (sizeof(counts) / sizeof(counts[0]));  i++)
+    {
+        const int steps = counts[i] >= 1000000 ? 10 : 100;
+        double single = 0.0;
+
+        if (!create_particle_system(&particle_system, counts[i]) ||
+            !create_snapshot(&snapshots[0], counts[i]))
+        {
+            fprintf(stderr, "Not enough memory for %i particles\n", counts[i]);
+            destroy_particle_system(&particle_system);
             break;
+        }
 
-        // Update particles
-        particle_engine(thread_sync.t, thread_sync.dt);
+        // Births walk around the arrays, so one step covering the whole life
+        // span brings every particle to life, spread over all ages
+        create_job_pool(&job_pool, max_threads);
+        particle_system.min_age = LIFE_SPAN - dt;
+        particle_engine(&particle_system, &job_pool, &snapshots[0], 0.0, dt);
+        destroy_job_pool(&job_pool);
+
+        // Powers of two up to the thread count, and the thread count itself
+        for (threads = 1;  threads <= max_threads;
+             threads = (threads < max_threads && threads * 2 > max_threads) ?
+                       max_threads : threads * 2)
+        {
+            double start, elapsed;
 
-        // Update frame counter
-        thread_sync.p_frame++;
+            create_job_pool(&job_pool, threads);
 
-        // Unlock mutex and signal drawing thread
-        mtx_unlock(&thread_sync.particles_lock);
-        cnd_signal(&thread_sync.p_done);
-    }
+            start = get_seconds();
+            for (j = 0;  j < steps;  j++)
+            {
+                particle_engine(&particle_system, &job_pool, &snapshots[0],
+                                (j + 1) * dt, dt);
+            }
+            elapsed = (get_seconds() - start) / steps;
 
-    return 0;
+            if (threads == 1)
+                single = elapsed;
+
+            printf("%10i %8i %12.3f %12.3f %8.2f\n",
+                   counts[i], job_pool.thread_count, elapsed * 1e3,
+                   elapsed * 1e9 / counts[i], single / elapsed);
+
+            destroy_job_pool(&job_pool);
+
+            if (threads == max_threads)
+                break;
+        }
+
+        destroy_snapshot(&snapshots[0]);
+        destroy_particle_system(&particle_system);
+    }
 }
 
 
@@ -942,30 +1619,65 @@ static int physics_thread_main(void* arg)
 
 int main(int argc, char** argv)
 {
-    int ch, width, height;
+    int ch, i, width, height;
+    int fullscreen = 0, single_thread = 0, run_benchmark = 0;
+    int count = DEFAULT_PARTICLES, threads = 0;
+    double t_old = 0.0;
     thrd_t physics_thread = 0;
     GLFWwindow* window;
     GLFWmonitor* monitor = NULL;
+    Snapshot* snapshot;
 
-    if (!glfwInit())
-    {
-        fprintf(stderr, "Failed to initialize GLFW\n");
-        exit(EXIT_FAILURE);
-    }
-
-    while ((ch = getopt(argc, argv, "fh")) != -1)
+    while ((ch = getopt(argc, argv, "bfhn:st:")) != -1)
     {
         switch (ch)
         {
+            case 'b':
+                run_benchmark = 1;
+                break;
             case 'f':
-                monitor = glfwGetPrimaryMonitor();
+                fullscreen = 1;
                 break;
             case 'h':
                 usage();
                 exit(EXIT_SUCCESS);
+            case 'n':
+                count = atoi(optarg);
+                break;
+            case 's':
+                single_thread = 1;
+                break;
+            case 't':
+                threads = atoi(optarg);
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
         }
     }
 
+    if (count < 1)
+        count = 1;
+
+    if (run_benchmark)
+    {
+        benchmark(threads > 0 ? threads : get_cpu_count());
+        exit(EXIT_SUCCESS);
+    }
+
+    // Leave one processor for the render thread
+    if (threads < 1)
+        threads = get_cpu_count() > 1 ? get_cpu_count() - 1 : 1;
+
+    if (!glfwInit())
+    {
+        fprintf(stderr, "Failed to initialize GLFW\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if (fullscreen)
+        monitor = glfwGetPrimaryMonitor();
+
     if (monitor)
     {
         const GLFWvidmode* mode = glfwGetVideoMode(monitor);
@@ -1034,37 +1746,72 @@ int main(int argc, char** argv)
                       GL_SEPARATE_SPECULAR_COLOR_EXT);
     }
 
+    init_instancing();
+
     // Set filled polygon mode as default (not wireframe)
     glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
     wireframe = 0;
 
-    // Set initial times
-    thread_sync.t  = 0.0;
-    thread_sync.dt = 0.001f;
-    thread_sync.p_frame = 0;
-    thread_sync.d_frame = 0;
-
-    mtx_init(&thread_sync.particles_lock, mtx_timed);
-    cnd_init(&thread_sync.p_done);
-    cnd_init(&thread_sync.d_done);
-
-    if (thrd_create(&physics_thread, physics_thread_main, window) != thrd_success)
+    if (!create_particle_system(&particle_system, count))
     {
+        fprintf(stderr, "Not enough memory for %i particles\n", count);
         glfwTerminate();
         exit(EXIT_FAILURE);
     }
 
+    for (i = 0;  i < 3;  i++)
+    {
+        if (!create_snapshot(&snapshots[i], count))
+        {
+            fprintf(stderr, "Not enough memory for %i particles\n", count);
+            glfwTerminate();
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    create_job_pool(&job_pool, single_thread ? 1 : threads);
+
     glfwSetTime(0.0);
 
+    if (!single_thread)
+    {
+        if (thrd_create(&physics_thread, physics_thread_main, window) != thrd_success)
+        {
+            glfwTerminate();
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    snapshot = snapshots + snapshot_write;
+
     while (!glfwWindowShouldClose(window))
     {
-        draw_scene(window, glfwGetTime());
+        const double t = glfwGetTime();
+
+        if (single_thread)
+        {
+            float dt = (float) (t - t_old);
+            if (dt > MAX_STEP_TIME)
+                dt = MAX_STEP_TIME;
+
+            particle_engine(&particle_system, &job_pool, snapshot, t_old, dt);
+            snapshot = publish_snapshot();
+            t_old = t;
+        }
+
+        draw_scene(window, t);
 
         glfwSwapBuffers(window);
         glfwPollEvents();
     }
 
-    thrd_join(physics_thread, NULL);
+    if (!single_thread)
+        thrd_join(physics_thread, NULL);
+
+    destroy_job_pool(&job_pool);
+    for (i = 0;  i < 3;  i++)
+        destroy_snapshot(&snapshots[i]);
+    destroy_particle_system(&particle_system);
 
     glfwDestroyWindow(window);
     glfwTerminate();
@@ -941,6 +941,12 @@ extern "C" {
  */
 #define GLFW_POSITION_Y             0x0002000F
 
+/*! @brief Input event queue window hint.
+ *
+ *  Input event queue capacity [window hint](@ref GLFW_EVENT_QUEUE_SIZE_hint).
+ */
+#define GLFW_EVENT_QUEUE_SIZE       0x00020010
+
 /*! @brief Framebuffer bit depth hint.
  *
  *  Framebuffer bit depth [hint](@ref GLFW_RED_BITS).
@@ -1125,6 +1131,10 @@ extern "C" {
  *  [window hint](@ref GLFW_X11_CLASS_NAME_hint).
  */
 #define GLFW_X11_INSTANCE_NAME      0x00024002
+/*! @brief X11 specific
+ *  [window hint](@ref GLFW_X11_COALESCE_MOTION_hint).
+ */
+#define GLFW_X11_COALESCE_MOTION    0x00024003
 #define GLFW_WIN32_KEYBOARD_MENU    0x00025001
 /*! @brief Win32 specific [window hint](@ref GLFW_WIN32_SHOWDEFAULT_hint).
  */
@@ -1345,6 +1355,40 @@ extern "C" {
 
 #define GLFW_DONT_CARE              -1
 
+/*! @addtogroup input
+ *  @{ */
+/*! @brief A key was pressed, repeated or released.
+ *
+ *  The `key`, `scancode`, `action` and `mods` members of @ref GLFWevent are set.
+ */
+#define GLFW_EVENT_KEY              1
+/*! @brief A Unicode character was input.
+ *
+ *  The `codepoint` and `mods` members of @ref GLFWevent are set.
+ */
+#define GLFW_EVENT_CHAR             2
+/*! @brief A mouse button was pressed or released.
+ *
+ *  The `button`, `action` and `mods` members of @ref GLFWevent are set.
+ */
+#define GLFW_EVENT_MOUSE_BUTTON     3
+/*! @brief The cursor moved.
+ *
+ *  The `x` and `y` members of @ref GLFWevent hold the new cursor position.
+ */
+#define GLFW_EVENT_CURSOR_POS       4
+/*! @brief The cursor entered or left the content area.
+ *
+ *  The `action` member of @ref GLFWevent is `GLFW_TRUE` when it entered.
+ */
+#define GLFW_EVENT_CURSOR_ENTER     5
+/*! @brief The mouse wheel or touchpad was scrolled.
+ *
+ *  The `x` and `y` members of @ref GLFWevent hold the scroll offsets.
+ */
+#define GLFW_EVENT_SCROLL           6
+/*! @} */
+
 
 /*************************************************************************
  * GLFW API types
@@ -2122,6 +2166,51 @@ typedef struct GLFWgamepadstate
     float axes[6];
 } GLFWgamepadstate;
 
+/*! @brief Queued input event.
+ *
+ *  This describes one input event recorded into a window's event queue.  Which
+ *  members are meaningful depends on the event type.
+ *
+ *  @sa @ref input_event_queue
+ *  @sa @ref glfwDrainEvents
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+typedef struct GLFWevent
+{
+    /*! The raw timer value, in the units of @ref glfwGetTimerFrequency, at
+     *  which GLFW processed the event.
+     */
+    uint64_t time;
+    /*! The event type, for example `GLFW_EVENT_KEY`.
+     */
+    int type;
+    /*! The [key](@ref keys) of a key event.
+     */
+    int key;
+    /*! The [mouse button](@ref buttons) of a mouse button event.
+     */
+    int button;
+    /*! The Unicode code point of a char event.
+     */
+    unsigned int codepoint;
+    /*! The platform-specific scancode of a key event.
+     */
+    int scancode;
+    /*! `GLFW_PRESS`, `GLFW_RELEASE` or `GLFW_REPEAT`, or the entered state of
+     *  a cursor enter event.
+     */
+    int action;
+    /*! The [modifier keys](@ref mods) held down.
+     */
+    int mods;
+    /*! The cursor position or scroll offset.
+     */
+    double x, y;
+} GLFWevent;
+
 /*! @brief Custom heap memory allocator.
  *
  *  This describes a custom heap memory allocator for GLFW.  To set an allocator, pass it
@@ -5451,6 +5540,140 @@ GLFWAPI GLFWscrollfun glfwSetScrollCallback(GLFWwindow* window, GLFWscrollfun ca
  */
 GLFWAPI GLFWdropfun glfwSetDropCallback(GLFWwindow* window, GLFWdropfun callback);
 
+/*! @brief Removes queued input events from a window's event queue.
+ *
+ *  This function copies up to `count` of the oldest events from the event
+ *  queue of the specified window into `events` and removes them from the
+ *  queue.  Events are returned in the order they were processed, each with the
+ *  [timer value](@ref glfwGetTimerValue) at which it was processed.
+ *
+ *  A window only has an event queue if it was created with a non-zero
+ *  [GLFW_EVENT_QUEUE_SIZE](@ref GLFW_EVENT_QUEUE_SIZE_hint) hint.  Key, char,
+ *  mouse button, cursor position, cursor enter and scroll events are added to
+ *  the queue as they are processed, in addition to being passed to any
+ *  callbacks.  If the queue is full, new events are dropped until it has been
+ *  drained.
+ *
+ *  @param[in] window The window whose events to drain.
+ *  @param[out] events Where to store the events.
+ *  @param[in] count The maximum number of events to store.
+ *  @return The number of events stored, or zero if the window has no event
+ *  queue or an [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_INVALID_VALUE.
+ *
+ *  @thread_safety The queue is a single producer, single consumer ring.  This
+ *  function may be called from any one thread at a time, concurrently with the
+ *  thread processing events.  The window must not be destroyed while it is
+ *  called.
+ *
+ *  @sa @ref input_event_queue
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+GLFWAPI int glfwDrainEvents(GLFWwindow* window, GLFWevent* events, int count);
+
+/*! @brief Starts recording the input of a window to a file.
+ *
+ *  This function starts writing every key, char, mouse button, cursor
+ *  position, cursor enter and scroll event of the specified window to a
+ *  compact binary file, together with the time since recording started.  The
+ *  file can later be played back with @ref glfwStartInputReplay.
+ *
+ *  Only one recording or replay can be active at a time.  Recording stops
+ *  when @ref glfwStopInputCapture is called or the window is destroyed.
+ *
+ *  @param[in] window The window whose input to record.
+ *  @param[in] path The path of the file to create or overwrite.
+ *  @return `GLFW_TRUE` if successful, or `GLFW_FALSE` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE and @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref input_replay
+ *  @sa @ref glfwStartInputReplay
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+GLFWAPI int glfwStartInputRecording(GLFWwindow* window, const char* path);
+
+/*! @brief Starts replaying recorded input into a window.
+ *
+ *  This function starts feeding the events of a file written by @ref
+ *  glfwStartInputRecording into the specified window.  While the replay is
+ *  active, the window ignores input from the platform and @ref glfwGetTime
+ *  returns a clock that advances by exactly `timestep` seconds every time
+ *  events are processed.  Every event whose recorded time has been reached
+ *  by that clock is delivered as if it came from the platform, so callbacks,
+ *  key and button state and the event queue all see it.
+ *
+ *  Event processing never blocks during a replay, so an application running
+ *  a replay on the [null platform](@ref GLFW_PLATFORM_NULL) produces the same
+ *  input and the same times on every run.
+ *
+ *  @param[in] window The window to replay input into.
+ *  @param[in] path The path of the recorded file.
+ *  @param[in] timestep The number of seconds the clock advances per call to
+ *  @ref glfwPollEvents or any of the wait functions.
+ *  @return `GLFW_TRUE` if successful, or `GLFW_FALSE` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE and @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref input_replay
+ *  @sa @ref glfwInputReplayFinished
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+GLFWAPI int glfwStartInputReplay(GLFWwindow* window, const char* path, double timestep);
+
+/*! @brief Stops any input recording or replay.
+ *
+ *  This function closes the file of the active recording or replay, if any.
+ *  After a replay has stopped, @ref glfwGetTime returns the real time again.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref input_replay
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+GLFWAPI void glfwStopInputCapture(void);
+
+/*! @brief Returns whether the active replay has delivered all its events.
+ *
+ *  @return `GLFW_TRUE` if a replay is active and has no events left, or
+ *  `GLFW_FALSE` otherwise.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref input_replay
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+GLFWAPI int glfwInputReplayFinished(void);
+
 /*! @brief Returns whether the specified joystick is present.
  *
  *  This function returns whether the specified joystick is present.
@@ -6209,6 +6432,93 @@ GLFWAPI void glfwSwapBuffers(GLFWwindow* window);
  */
 GLFWAPI void glfwSwapInterval(int interval);
 
+/*! @brief Sets the frame rate and GPU queue depth of a window.
+ *
+ *  This function configures how @ref glfwWaitForFrame paces the frames of the
+ *  specified window.
+ *
+ *  A positive `frameRate` makes @ref glfwWaitForFrame return at most that many
+ *  times per second, sleeping for most of the wait and spinning only for the
+ *  last millisecond or so to keep the error small.  A frame rate of zero or
+ *  `GLFW_DONT_CARE` leaves pacing to the [swap interval](@ref buffer_swap),
+ *  so a vsync interval of N with no frame rate gives one frame every N screen
+ *  updates.
+ *
+ *  `framesInFlight` limits how many frames the GPU may queue behind the CPU.
+ *  Each @ref glfwSwapBuffers inserts a fence into the window's context and
+ *  @ref glfwWaitForFrame waits until no more than `framesInFlight` of them are
+ *  pending.  Zero waits for every frame to finish, trading throughput for the
+ *  lowest latency.  `GLFW_DONT_CARE` inserts no fences and leaves the queue
+ *  depth to the driver, which is also what happens if the context does not
+ *  support sync objects.
+ *
+ *  @param[in] window The window to pace.
+ *  @param[in] frameRate The target number of frames per second, or zero or
+ *  `GLFW_DONT_CARE` to pace by the swap interval alone.
+ *  @param[in] framesInFlight The maximum number of frames queued on the GPU,
+ *  up to eight, or `GLFW_DONT_CARE`.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_INVALID_VALUE.
+ *
+ *  @remark Pending fences are deleted only if the window's context is current
+ *  on the calling thread, otherwise they are waited on as before until they
+ *  have signaled.
+ *
+ *  @thread_safety This function may be called from any thread, but not
+ *  concurrently with @ref glfwWaitForFrame or @ref glfwSwapBuffers for the
+ *  same window.
+ *
+ *  @sa @ref frame_pacing
+ *  @sa @ref glfwWaitForFrame
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup context
+ */
+GLFWAPI void glfwSetFramePacing(GLFWwindow* window, double frameRate, int framesInFlight);
+
+/*! @brief Waits until it is time to start the next frame of a window.
+ *
+ *  This function waits until the GPU queue of the specified window is below the
+ *  limit set with @ref glfwSetFramePacing and the next frame is due at the
+ *  target frame rate, then processes pending events.  While it waits it
+ *  sleeps in the platform event wait, so events arriving in the meantime are
+ *  processed as they arrive.
+ *
+ *  Events are processed once more right before returning, so input sampled
+ *  after this call is as recent as possible.  Call it at the start of the
+ *  frame, in place of @ref glfwPollEvents, and read input after it returns.
+ *
+ *  If a frame took longer than its period, the deadline of the next frame is
+ *  moved to the current time instead of trying to catch up.
+ *
+ *  @param[in] window The window whose next frame to wait for.
+ *  @return The [time](@ref time) at which the wait ended, or zero if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark The fences of the window are waited on only if its context is
+ *  current on the calling thread.
+ *
+ *  @remark During an [input replay](@ref input_replay) this function does not
+ *  wait and processes events exactly once, so the replay stays deterministic.
+ *
+ *  @reentrancy This function must not be called from a callback.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref frame_pacing
+ *  @sa @ref glfwSetFramePacing
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup context
+ */
+GLFWAPI double glfwWaitForFrame(GLFWwindow* window);
+
 /*! @brief Returns whether the specified extension is available.
  *
  *  This function returns whether the specified
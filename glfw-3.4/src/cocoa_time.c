@@ -29,6 +29,8 @@
 #if defined(GLFW_BUILD_COCOA_TIMER)
 
 #include <mach/mach_time.h>
+#include <errno.h>
+#include <time.h>
 
 
 //////////////////////////////////////////////////////////////////////////
@@ -53,5 +55,15 @@ uint64_t _glfwPlatformGetTimerFrequency(void)
     return _glfw.timer.ns.frequency;
 }
 
+void _glfwPlatformSleep(double seconds)
+{
+    struct timespec ts;
+    ts.tv_sec = (time_t) seconds;
+    ts.tv_nsec = (long) ((seconds - ts.tv_sec) * 1e9);
+
+    while (nanosleep(&ts, &ts) == -1 && errno == EINTR)
+        ;
+}
+
 #endif // GLFW_BUILD_COCOA_TIMER
 
@@ -565,6 +565,31 @@ GLFWbool _glfwRefreshContextAttribs(_GLFWwindow* window,
             window->context.release = GLFW_RELEASE_BEHAVIOR_FLUSH;
     }
 
+    // Sync objects are used by frame pacing to bound the frames in flight
+    if ((window->context.client == GLFW_OPENGL_API &&
+         (window->context.major >= 4 ||
+          (window->context.major == 3 && window->context.minor >= 2))) ||
+        (window->context.client == GLFW_OPENGL_ES_API &&
+         window->context.major >= 3) ||
+        glfwExtensionSupported("GL_ARB_sync"))
+    {
+        window->context.FenceSync = (PFNGLFENCESYNCPROC)
+            window->context.getProcAddress("glFenceSync");
+        window->context.ClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)
+            window->context.getProcAddress("glClientWaitSync");
+        window->context.DeleteSync = (PFNGLDELETESYNCPROC)
+            window->context.getProcAddress("glDeleteSync");
+
+        if (!window->context.FenceSync ||
+            !window->context.ClientWaitSync ||
+            !window->context.DeleteSync)
+        {
+            window->context.FenceSync = NULL;
+            window->context.ClientWaitSync = NULL;
+            window->context.DeleteSync = NULL;
+        }
+    }
+
     // Clearing the front buffer to black to avoid garbage pixels left over from
     // previous uses of our bit of VRAM
     {
@@ -660,6 +685,7 @@ GLFWAPI void glfwSwapBuffers(GLFWwindow* handle)
     }
 
     window->context.swapBuffers(window);
+    _glfwFramePresented(window);
 }
 
 GLFWAPI void glfwSwapInterval(int interval)
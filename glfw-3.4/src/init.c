@@ -118,6 +118,11 @@ static void terminate(void)
     _glfw_free(_glfw.mappings);
     _glfw.mappings = NULL;
     _glfw.mappingCount = 0;
+    _glfw.mappingCapacity = 0;
+
+    _glfw_free(_glfw.mappingIndex);
+    _glfw.mappingIndex = NULL;
+    _glfw.mappingIndexSize = 0;
 
     _glfwTerminateVulkan();
     _glfw.platform.terminateJoysticks();
@@ -65,19 +65,110 @@ static GLFWbool initJoysticks(void)
     return _glfw.joysticksInitialized = GLFW_TRUE;
 }
 
-// Finds a mapping based on joystick GUID
+// Returns the FNV-1a hash of a joystick GUID string
 //
-static _GLFWmapping* findMapping(const char* guid)
+static uint32_t hashGUID(const char* guid)
 {
-    int i;
+    uint32_t hash = 2166136261u;
+
+    while (*guid)
+    {
+        hash ^= (unsigned char) *guid++;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// Returns the mapping index slot for the specified GUID, which is either the slot
+// holding that mapping or the empty slot where it would be inserted
+//
+static int* findMappingSlot(const char* guid)
+{
+    const uint32_t mask = (uint32_t) _glfw.mappingIndexSize - 1;
+    uint32_t i = hashGUID(guid) & mask;
+
+    // Linear probing; the index is kept at most half full so this terminates
+    while (_glfw.mappingIndex[i] != -1)
+    {
+        if (strcmp(_glfw.mappings[_glfw.mappingIndex[i]].guid, guid) == 0)
+            break;
+
+        i = (i + 1) & mask;
+    }
 
+    return _glfw.mappingIndex + i;
+}
+
+// Makes room for at least the specified number of mappings, growing the mapping
+// array and its GUID index geometrically
+//
+static void reserveMappings(int count)
+{
+    int i, size;
+
+    if (count > _glfw.mappingCapacity)
+    {
+        int capacity = _glfw.mappingCapacity ? _glfw.mappingCapacity : 64;
+        while (capacity < count)
+            capacity *= 2;
+
+        _glfw.mappings = _glfw_realloc(_glfw.mappings,
+                                       sizeof(_GLFWmapping) * capacity);
+        _glfw.mappingCapacity = capacity;
+    }
+
+    size = _glfw.mappingIndexSize ? _glfw.mappingIndexSize : 128;
+    while (size < count * 2)
+        size *= 2;
+
+    if (size == _glfw.mappingIndexSize)
+        return;
+
+    _glfw_free(_glfw.mappingIndex);
+    _glfw.mappingIndex = _glfw_calloc(size, sizeof(int));
+    _glfw.mappingIndexSize = size;
+
+    memset(_glfw.mappingIndex, 0xff, sizeof(int) * size);
     for (i = 0;  i < _glfw.mappingCount;  i++)
+        *findMappingSlot(_glfw.mappings[i].guid) = i;
+}
+
+// Adds a mapping, or replaces the existing mapping with the same GUID if
+// replace is set
+//
+static void addMapping(const _GLFWmapping* mapping, GLFWbool replace)
+{
+    int* slot;
+
+    reserveMappings(_glfw.mappingCount + 1);
+
+    slot = findMappingSlot(mapping->guid);
+    if (*slot != -1)
     {
-        if (strcmp(_glfw.mappings[i].guid, guid) == 0)
-            return _glfw.mappings + i;
+        if (replace)
+            _glfw.mappings[*slot] = *mapping;
+        return;
     }
 
-    return NULL;
+    *slot = _glfw.mappingCount;
+    _glfw.mappings[_glfw.mappingCount++] = *mapping;
+}
+
+// Finds a mapping based on joystick GUID
+//
+static _GLFWmapping* findMapping(const char* guid)
+{
+    int* slot;
+
+    if (!_glfw.mappingIndexSize)
+        return NULL;
+
+    slot = findMappingSlot(guid);
+    if (*slot == -1)
+        return NULL;
+
+    return _glfw.mappings + *slot;
 }
 
 // Checks whether a gamepad mapping element is present in the hardware
@@ -263,6 +354,67 @@ static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
 }
 
 
+#if defined(_MSC_VER)
+ #include <intrin.h>
+#endif
+
+// Loads an event queue index written by the other side of the queue
+//
+static uint32_t loadAcquire(volatile uint32_t* index)
+{
+#if defined(_MSC_VER)
+    return (uint32_t) _InterlockedOr((volatile long*) index, 0);
+#else
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+#endif
+}
+
+// Publishes an event queue index to the other side of the queue
+//
+static void storeRelease(volatile uint32_t* index, uint32_t value)
+{
+#if defined(_MSC_VER)
+    _InterlockedExchange((volatile long*) index, (long) value);
+#else
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+#endif
+}
+
+// Returns whether platform input to the window is replaced by a replay
+//
+static GLFWbool isInputReplayed(const _GLFWwindow* window)
+{
+    return _glfw.capture.replaying &&
+           !_glfw.capture.injecting &&
+           _glfw.capture.window == window;
+}
+
+// Stamps an input event and passes it to the window's event queue and to any
+// recording in progress
+//
+static void queueEvent(_GLFWwindow* window, GLFWevent* event)
+{
+    uint32_t head;
+
+    if (!window->eventQueue.capacity && !_glfw.capture.recording)
+        return;
+
+    event->time = _glfwPlatformGetTimerValue();
+    _glfwRecordEvent(window, event);
+
+    if (!window->eventQueue.capacity)
+        return;
+
+    // Drop the event if the queue is full
+    head = window->eventQueue.head;
+    if (head - loadAcquire(&window->eventQueue.tail) == window->eventQueue.capacity)
+        return;
+
+    window->eventQueue.events[head & (window->eventQueue.capacity - 1)] = *event;
+    storeRelease(&window->eventQueue.head, head + 1);
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 //////                         GLFW event API                       //////
 //////////////////////////////////////////////////////////////////////////
@@ -271,12 +423,17 @@ static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
 //
 void _glfwInputKey(_GLFWwindow* window, int key, int scancode, int action, int mods)
 {
+    GLFWevent event = {0};
+
     assert(window != NULL);
     assert(key >= 0 || key == GLFW_KEY_UNKNOWN);
     assert(key <= GLFW_KEY_LAST);
     assert(action == GLFW_PRESS || action == GLFW_RELEASE);
     assert(mods == (mods & GLFW_MOD_MASK));
 
+    if (isInputReplayed(window))
+        return;
+
     if (key >= 0 && key <= GLFW_KEY_LAST)
     {
         GLFWbool repeated = GLFW_FALSE;
@@ -299,6 +456,13 @@ void _glfwInputKey(_GLFWwindow* window, int key, int scancode, int action, int m
     if (!window->lockKeyMods)
         mods &= ~(GLFW_MOD_CAPS_LOCK | GLFW_MOD_NUM_LOCK);
 
+    event.type = GLFW_EVENT_KEY;
+    event.key = key;
+    event.scancode = scancode;
+    event.action = action;
+    event.mods = mods;
+    queueEvent(window, &event);
+
     if (window->callbacks.key)
         window->callbacks.key((GLFWwindow*) window, key, scancode, action, mods);
 }
@@ -308,16 +472,26 @@ void _glfwInputKey(_GLFWwindow* window, int key, int scancode, int action, int m
 //
 void _glfwInputChar(_GLFWwindow* window, uint32_t codepoint, int mods, GLFWbool plain)
 {
+    GLFWevent event = {0};
+
     assert(window != NULL);
     assert(mods == (mods & GLFW_MOD_MASK));
     assert(plain == GLFW_TRUE || plain == GLFW_FALSE);
 
+    if (isInputReplayed(window))
+        return;
+
     if (codepoint < 32 || (codepoint > 126 && codepoint < 160))
         return;
 
     if (!window->lockKeyMods)
         mods &= ~(GLFW_MOD_CAPS_LOCK | GLFW_MOD_NUM_LOCK);
 
+    event.type = GLFW_EVENT_CHAR;
+    event.codepoint = codepoint;
+    event.mods = mods;
+    queueEvent(window, &event);
+
     if (window->callbacks.charmods)
         window->callbacks.charmods((GLFWwindow*) window, codepoint, mods);
 
@@ -332,12 +506,22 @@ void _glfwInputChar(_GLFWwindow* window, uint32_t codepoint, int mods, GLFWbool
 //
 void _glfwInputScroll(_GLFWwindow* window, double xoffset, double yoffset)
 {
+    GLFWevent event = {0};
+
     assert(window != NULL);
     assert(xoffset > -FLT_MAX);
     assert(xoffset < FLT_MAX);
     assert(yoffset > -FLT_MAX);
     assert(yoffset < FLT_MAX);
 
+    if (isInputReplayed(window))
+        return;
+
+    event.type = GLFW_EVENT_SCROLL;
+    event.x = xoffset;
+    event.y = yoffset;
+    queueEvent(window, &event);
+
     if (window->callbacks.scroll)
         window->callbacks.scroll((GLFWwindow*) window, xoffset, yoffset);
 }
@@ -346,12 +530,17 @@ void _glfwInputScroll(_GLFWwindow* window, double xoffset, double yoffset)
 //
 void _glfwInputMouseClick(_GLFWwindow* window, int button, int action, int mods)
 {
+    GLFWevent event = {0};
+
     assert(window != NULL);
     assert(button >= 0);
     assert(button <= GLFW_MOUSE_BUTTON_LAST);
     assert(action == GLFW_PRESS || action == GLFW_RELEASE);
     assert(mods == (mods & GLFW_MOD_MASK));
 
+    if (isInputReplayed(window))
+        return;
+
     if (button < 0 || button > GLFW_MOUSE_BUTTON_LAST)
         return;
 
@@ -363,6 +552,12 @@ void _glfwInputMouseClick(_GLFWwindow* window, int button, int action, int mods)
     else
         window->mouseButtons[button] = (char) action;
 
+    event.type = GLFW_EVENT_MOUSE_BUTTON;
+    event.button = button;
+    event.action = action;
+    event.mods = mods;
+    queueEvent(window, &event);
+
     if (window->callbacks.mouseButton)
         window->callbacks.mouseButton((GLFWwindow*) window, button, action, mods);
 }
@@ -372,18 +567,28 @@ void _glfwInputMouseClick(_GLFWwindow* window, int button, int action, int mods)
 //
 void _glfwInputCursorPos(_GLFWwindow* window, double xpos, double ypos)
 {
+    GLFWevent event = {0};
+
     assert(window != NULL);
     assert(xpos > -FLT_MAX);
     assert(xpos < FLT_MAX);
     assert(ypos > -FLT_MAX);
     assert(ypos < FLT_MAX);
 
+    if (isInputReplayed(window))
+        return;
+
     if (window->virtualCursorPosX == xpos && window->virtualCursorPosY == ypos)
         return;
 
     window->virtualCursorPosX = xpos;
     window->virtualCursorPosY = ypos;
 
+    event.type = GLFW_EVENT_CURSOR_POS;
+    event.x = xpos;
+    event.y = ypos;
+    queueEvent(window, &event);
+
     if (window->callbacks.cursorPos)
         window->callbacks.cursorPos((GLFWwindow*) window, xpos, ypos);
 }
@@ -392,9 +597,18 @@ void _glfwInputCursorPos(_GLFWwindow* window, double xpos, double ypos)
 //
 void _glfwInputCursorEnter(_GLFWwindow* window, GLFWbool entered)
 {
+    GLFWevent event = {0};
+
     assert(window != NULL);
     assert(entered == GLFW_TRUE || entered == GLFW_FALSE);
 
+    if (isInputReplayed(window))
+        return;
+
+    event.type = GLFW_EVENT_CURSOR_ENTER;
+    event.action = entered;
+    queueEvent(window, &event);
+
     if (window->callbacks.cursorEnter)
         window->callbacks.cursorEnter((GLFWwindow*) window, entered);
 }
@@ -487,12 +701,17 @@ void _glfwInitGamepadMappings(void)
 {
     size_t i;
     const size_t count = sizeof(_glfwDefaultMappings) / sizeof(char*);
-    _glfw.mappings = _glfw_calloc(count, sizeof(_GLFWmapping));
+
+    // Size the array and index once up front so the whole table is added in one pass
+    reserveMappings((int) count);
 
     for (i = 0;  i < count;  i++)
     {
-        if (parseMapping(&_glfw.mappings[_glfw.mappingCount], _glfwDefaultMappings[i]))
-            _glfw.mappingCount++;
+        _GLFWmapping mapping = {{0}};
+
+        // The first of several built-in mappings for the same GUID wins
+        if (parseMapping(&mapping, _glfwDefaultMappings[i]))
+            addMapping(&mapping, GLFW_FALSE);
     }
 }
 
@@ -790,7 +1009,9 @@ GLFWAPI void glfwGetCursorPos(GLFWwindow* handle, double* xpos, double* ypos)
 
     _GLFW_REQUIRE_INIT();
 
-    if (window->cursorMode == GLFW_CURSOR_DISABLED)
+    // A replayed cursor only exists as the virtual position
+    if (window->cursorMode == GLFW_CURSOR_DISABLED ||
+        (_glfw.capture.replaying && _glfw.capture.window == window))
     {
         if (xpos)
             *xpos = window->virtualCursorPosX;
@@ -1027,6 +1248,42 @@ GLFWAPI GLFWdropfun glfwSetDropCallback(GLFWwindow* handle, GLFWdropfun cbfun)
     return cbfun;
 }
 
+GLFWAPI int glfwDrainEvents(GLFWwindow* handle, GLFWevent* events, int count)
+{
+    uint32_t head, tail, available, i;
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+    assert(events != NULL);
+    assert(count >= 0);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
+
+    if (count < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid event count %i", count);
+        return 0;
+    }
+
+    if (!window->eventQueue.capacity)
+        return 0;
+
+    tail = window->eventQueue.tail;
+    head = loadAcquire(&window->eventQueue.head);
+
+    available = head - tail;
+    if (available > (uint32_t) count)
+        available = (uint32_t) count;
+
+    for (i = 0;  i < available;  i++)
+    {
+        const uint32_t slot = (tail + i) & (window->eventQueue.capacity - 1);
+        events[i] = window->eventQueue.events[slot];
+    }
+
+    storeRelease(&window->eventQueue.tail, tail + available);
+    return (int) available;
+}
+
 GLFWAPI int glfwJoystickPresent(int jid)
 {
     _GLFWjoystick* js;
@@ -1277,19 +1534,7 @@ GLFWAPI int glfwUpdateGamepadMappings(const char* string)
                 line[length] = '\0';
 
                 if (parseMapping(&mapping, line))
-                {
-                    _GLFWmapping* previous = findMapping(mapping.guid);
-                    if (previous)
-                        *previous = mapping;
-                    else
-                    {
-                        _glfw.mappingCount++;
-                        _glfw.mappings =
-                            _glfw_realloc(_glfw.mappings,
-                                          sizeof(_GLFWmapping) * _glfw.mappingCount);
-                        _glfw.mappings[_glfw.mappingCount - 1] = mapping;
-                    }
-                }
+                    addMapping(&mapping, GLFW_TRUE);
             }
 
             c += length;
@@ -1473,6 +1718,11 @@ GLFWAPI const char* glfwGetClipboardString(GLFWwindow* handle)
 GLFWAPI double glfwGetTime(void)
 {
     _GLFW_REQUIRE_INIT_OR_RETURN(0.0);
+
+    // Replays run on a fixed time step clock so every run sees the same times
+    if (_glfw.capture.replaying)
+        return _glfw.capture.time;
+
     return (double) (_glfwPlatformGetTimerValue() - _glfw.timer.offset) /
         _glfwPlatformGetTimerFrequency();
 }
@@ -58,6 +58,8 @@
 
 #define _GLFW_MESSAGE_SIZE      1024
 
+#define _GLFW_MAX_FRAME_FENCES  8
+
 typedef int GLFWbool;
 typedef void (*GLFWproc)(void);
 
@@ -108,6 +110,18 @@ typedef const GLubyte* (APIENTRY * PFNGLGETSTRINGPROC)(GLenum);
 typedef void (APIENTRY * PFNGLGETINTEGERVPROC)(GLenum,GLint*);
 typedef const GLubyte* (APIENTRY * PFNGLGETSTRINGIPROC)(GLenum,GLuint);
 
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#define GL_TIMEOUT_EXPIRED 0x911b
+#define GL_WAIT_FAILED 0x911d
+
+typedef struct __GLsync* GLsync;
+typedef uint64_t GLuint64;
+
+typedef GLsync (APIENTRY * PFNGLFENCESYNCPROC)(GLenum,GLbitfield);
+typedef GLenum (APIENTRY * PFNGLCLIENTWAITSYNCPROC)(GLsync,GLbitfield,GLuint64);
+typedef void (APIENTRY * PFNGLDELETESYNCPROC)(GLsync);
+
 #define EGL_SUCCESS 0x3000
 #define EGL_NOT_INITIALIZED 0x3001
 #define EGL_BAD_ACCESS 0x3002
@@ -406,12 +420,14 @@ struct _GLFWwndconfig
     GLFWbool      mousePassthrough;
     GLFWbool      scaleToMonitor;
     GLFWbool      scaleFramebuffer;
+    int           eventQueueSize;
     struct {
         char      frameName[256];
     } ns;
     struct {
         char      className[256];
         char      instanceName[256];
+        GLFWbool  coalesceMotion;
     } x11;
     struct {
         GLFWbool  keymenu;
@@ -491,6 +507,11 @@ struct _GLFWcontext
     PFNGLGETINTEGERVPROC GetIntegerv;
     PFNGLGETSTRINGPROC   GetString;
 
+    // Sync objects (OpenGL 3.2, OpenGL ES 3.0 or ARB_sync), NULL if unavailable
+    PFNGLFENCESYNCPROC      FenceSync;
+    PFNGLCLIENTWAITSYNCPROC ClientWaitSync;
+    PFNGLDELETESYNCPROC     DeleteSync;
+
     void (*makeCurrent)(_GLFWwindow*);
     void (*swapBuffers)(_GLFWwindow*);
     void (*swapInterval)(int);
@@ -551,6 +572,25 @@ struct _GLFWwindow
     double              virtualCursorPosX, virtualCursorPosY;
     GLFWbool            rawMouseMotion;
 
+    // Frame pacing, see pacing.c
+    struct {
+        double          period;
+        int             framesInFlight;
+        uint64_t        deadline;
+        // Fences of submitted frames, oldest first
+        GLsync          fences[_GLFW_MAX_FRAME_FENCES + 1];
+        int             fenceCount;
+    } pacing;
+
+    // Opt-in single producer, single consumer input event ring
+    struct {
+        GLFWevent*        events;
+        // Capacity is a power of two; head and tail only ever increase
+        uint32_t          capacity;
+        volatile uint32_t head;
+        volatile uint32_t tail;
+    } eventQueue;
+
     _GLFWcontext        context;
 
     struct {
@@ -779,6 +819,10 @@ struct _GLFWlibrary
     _GLFWjoystick       joysticks[GLFW_JOYSTICK_LAST + 1];
     _GLFWmapping*       mappings;
     int                 mappingCount;
+    int                 mappingCapacity;
+    // Open addressing GUID index into mappings, -1 for empty slots
+    int*                mappingIndex;
+    int                 mappingIndexSize;
 
     _GLFWtls            errorSlot;
     _GLFWtls            contextSlot;
@@ -790,6 +834,22 @@ struct _GLFWlibrary
         GLFW_PLATFORM_LIBRARY_TIMER_STATE
     } timer;
 
+    // Input recording and replay, see replay.c
+    struct {
+        void*           file;
+        _GLFWwindow*    window;
+        GLFWbool        recording;
+        GLFWbool        replaying;
+        GLFWbool        injecting;
+        GLFWbool        finished;
+        uint64_t        start;
+        double          time;
+        double          timestep;
+        GLFWevent       next;
+        double          nextTime;
+        GLFWbool        hasNext;
+    } capture;
+
     struct {
         EGLenum         platform;
         EGLDisplay      display;
@@ -885,6 +945,7 @@ extern _GLFWlibrary _glfw;
 void _glfwPlatformInitTimer(void);
 uint64_t _glfwPlatformGetTimerValue(void);
 uint64_t _glfwPlatformGetTimerFrequency(void);
+void _glfwPlatformSleep(double seconds);
 
 GLFWbool _glfwPlatformCreateTls(_GLFWtls* tls);
 void _glfwPlatformDestroyTls(_GLFWtls* tls);
@@ -974,6 +1035,13 @@ _GLFWjoystick* _glfwAllocJoystick(const char* name,
 void _glfwFreeJoystick(_GLFWjoystick* js);
 void _glfwCenterCursorInContentArea(_GLFWwindow* window);
 
+void _glfwRecordEvent(_GLFWwindow* window, const GLFWevent* event);
+void _glfwAdvanceReplay(void);
+void _glfwStopInputCapture(void);
+
+void _glfwFramePresented(_GLFWwindow* window);
+void _glfwReleaseFrameFences(_GLFWwindow* window);
+
 GLFWbool _glfwInitEGL(void);
 void _glfwTerminateEGL(void);
 GLFWbool _glfwCreateContextEGL(_GLFWwindow* window,
@@ -32,6 +32,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/inotify.h>
+#include <sys/epoll.h>
 #include <fcntl.h>
 #include <errno.h>
 #include <dirent.h>
@@ -45,6 +46,9 @@
 #define SYN_DROPPED 3
 #endif
 
+// The number of device events read per system call
+#define _GLFW_JOYSTICK_READ_BATCH 64
+
 // Apply an EV_KEY event to the specified joystick
 //
 static void handleKeyEvent(_GLFWjoystick* js, int code, int value)
@@ -120,6 +124,26 @@ static void pollAbsState(_GLFWjoystick* js)
     }
 }
 
+// Adds a file descriptor to the epoll set, tagged with its joystick or NULL
+//
+static void watchDescriptor(int fd, _GLFWjoystick* js)
+{
+    struct epoll_event event = {0};
+
+    if (_glfw.linjs.epoll < 0)
+        return;
+
+    event.events = EPOLLIN;
+    event.data.ptr = js;
+
+    if (epoll_ctl(_glfw.linjs.epoll, EPOLL_CTL_ADD, fd, &event) < 0)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Linux: Failed to add descriptor to epoll set: %s",
+                        strerror(errno));
+    }
+}
+
 #define isBitSet(bit, arr) (arr[(bit) / 8] & (1 << ((bit) % 8)))
 
 // Attempt to open the specified joystick device
@@ -234,6 +258,7 @@ static GLFWbool openJoystickDevice(const char* path)
     memcpy(&js->linjs, &linjs, sizeof(linjs));
 
     pollAbsState(js);
+    watchDescriptor(js->linjs.fd, js);
 
     _glfwInputJoystick(js, GLFW_CONNECTED);
     return GLFW_TRUE;
@@ -246,25 +271,67 @@ static GLFWbool openJoystickDevice(const char* path)
 static void closeJoystick(_GLFWjoystick* js)
 {
     _glfwInputJoystick(js, GLFW_DISCONNECTED);
+    if (_glfw.linjs.epoll >= 0)
+        epoll_ctl(_glfw.linjs.epoll, EPOLL_CTL_DEL, js->linjs.fd, NULL);
     close(js->linjs.fd);
     _glfwFreeJoystick(js);
 }
 
-// Lexically compare joysticks by name; used by qsort
+// Reads and applies all queued events of the specified joystick
 //
-static int compareJoysticks(const void* fp, const void* sp)
+static void readJoystickEvents(_GLFWjoystick* js)
 {
-    const _GLFWjoystick* fj = fp;
-    const _GLFWjoystick* sj = sp;
-    return strcmp(fj->linjs.path, sj->linjs.path);
-}
+    struct input_event events[_GLFW_JOYSTICK_READ_BATCH];
+
+    for (;;)
+    {
+        errno = 0;
+        const ssize_t size = read(js->linjs.fd, events, sizeof(events));
+        if (size < 0)
+        {
+            // Reset the joystick slot if the device was disconnected
+            if (errno == ENODEV)
+                closeJoystick(js);
 
+            return;
+        }
 
-//////////////////////////////////////////////////////////////////////////
-//////                       GLFW internal API                      //////
-//////////////////////////////////////////////////////////////////////////
+        const int count = (int) (size / sizeof(struct input_event));
+
+        for (int i = 0;  i < count;  i++)
+        {
+            const struct input_event* e = events + i;
+
+            if (e->type == EV_SYN)
+            {
+                if (e->code == SYN_DROPPED)
+                    _glfw.linjs.dropped = GLFW_TRUE;
+                else if (e->code == SYN_REPORT)
+                {
+                    _glfw.linjs.dropped = GLFW_FALSE;
+                    pollAbsState(js);
+                }
+            }
+
+            if (_glfw.linjs.dropped)
+                continue;
+
+            if (e->type == EV_KEY)
+                handleKeyEvent(js, e->code, e->value);
+            else if (e->type == EV_ABS)
+                handleAbsEvent(js, e->code, e->value);
+        }
 
-void _glfwDetectJoystickConnectionLinux(void)
+        // A short read means the queue has been drained
+        if (count < _GLFW_JOYSTICK_READ_BATCH)
+            return;
+    }
+}
+
+// Opens or closes joysticks for the device nodes added or removed since the
+// last call
+//
+static void detectJoystickConnection(void)
 {
     if (_glfw.linjs.inotify <= 0)
         return;
@@ -302,6 +369,47 @@ void _glfwDetectJoystickConnectionLinux(void)
     }
 }
 
+// Lexically compare joysticks by name; used by qsort
+//
+static int compareJoysticks(const void* fp, const void* sp)
+{
+    const _GLFWjoystick* fj = fp;
+    const _GLFWjoystick* sj = sp;
+    return strcmp(fj->linjs.path, sj->linjs.path);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Reads the events of every device and the hotplug watch that have any queued,
+// with one readiness query for all of them
+//
+void _glfwDispatchJoystickEventsLinux(void)
+{
+    struct epoll_event events[GLFW_JOYSTICK_LAST + 2];
+
+    if (_glfw.linjs.epoll < 0)
+    {
+        detectJoystickConnection();
+        return;
+    }
+
+    const int count = epoll_wait(_glfw.linjs.epoll, events,
+                                 sizeof(events) / sizeof(events[0]), 0);
+
+    for (int i = 0;  i < count;  i++)
+    {
+        _GLFWjoystick* js = events[i].data.ptr;
+
+        if (!js)
+            detectJoystickConnection();
+        else if (js->connected)
+            readJoystickEvents(js);
+    }
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
@@ -311,6 +419,9 @@ GLFWbool _glfwInitJoysticksLinux(void)
 {
     const char* dirname = "/dev/input";
 
+    // Devices opened during enumeration are added once their slots are final
+    _glfw.linjs.epoll = -1;
+
     _glfw.linjs.inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
     if (_glfw.linjs.inotify > 0)
     {
@@ -359,6 +470,23 @@ GLFWbool _glfwInitJoysticksLinux(void)
     // Continue with no joysticks if enumeration fails
 
     qsort(_glfw.joysticks, count, sizeof(_GLFWjoystick), compareJoysticks);
+
+    // Continue with per-query device reads if epoll fails
+
+    _glfw.linjs.epoll = epoll_create1(EPOLL_CLOEXEC);
+    if (_glfw.linjs.epoll >= 0)
+    {
+        if (_glfw.linjs.inotify > 0)
+            watchDescriptor(_glfw.linjs.inotify, NULL);
+
+        for (int jid = 0;  jid <= GLFW_JOYSTICK_LAST;  jid++)
+        {
+            _GLFWjoystick* js = _glfw.joysticks + jid;
+            if (js->connected)
+                watchDescriptor(js->linjs.fd, js);
+        }
+    }
+
     return GLFW_TRUE;
 }
 
@@ -379,46 +507,21 @@ void _glfwTerminateJoysticksLinux(void)
         close(_glfw.linjs.inotify);
     }
 
+    if (_glfw.linjs.epoll >= 0)
+        close(_glfw.linjs.epoll);
+
     if (_glfw.linjs.regexCompiled)
         regfree(&_glfw.linjs.regex);
 }
 
 GLFWbool _glfwPollJoystickLinux(_GLFWjoystick* js, int mode)
 {
-    // Read all queued events (non-blocking)
-    for (;;)
-    {
-        struct input_event e;
-
-        errno = 0;
-        if (read(js->linjs.fd, &e, sizeof(e)) < 0)
-        {
-            // Reset the joystick slot if the device was disconnected
-            if (errno == ENODEV)
-                closeJoystick(js);
-
-            break;
-        }
-
-        if (e.type == EV_SYN)
-        {
-            if (e.code == SYN_DROPPED)
-                _glfw.linjs.dropped = GLFW_TRUE;
-            else if (e.code == SYN_REPORT)
-            {
-                _glfw.linjs.dropped = GLFW_FALSE;
-                pollAbsState(js);
-            }
-        }
-
-        if (_glfw.linjs.dropped)
-            continue;
-
-        if (e.type == EV_KEY)
-            handleKeyEvent(js, e.code, e.value);
-        else if (e.type == EV_ABS)
-            handleAbsEvent(js, e.code, e.value);
-    }
+    // One readiness query covers every device, and devices without queued
+    // events are not read at all
+    if (_glfw.linjs.epoll >= 0)
+        _glfwDispatchJoystickEventsLinux();
+    else
+        readJoystickEvents(js);
 
     return js->connected;
 }
@@ -49,12 +49,14 @@ typedef struct _GLFWlibraryLinux
 {
     int                     inotify;
     int                     watch;
+    // Covers inotify and every device, so event waits wake on joystick input
+    int                     epoll;
     regex_t                 regex;
     GLFWbool                regexCompiled;
     GLFWbool                dropped;
 } _GLFWlibraryLinux;
 
-void _glfwDetectJoystickConnectionLinux(void);
+void _glfwDispatchJoystickEventsLinux(void);
 
 GLFWbool _glfwInitJoysticksLinux(void);
 void _glfwTerminateJoysticksLinux(void);
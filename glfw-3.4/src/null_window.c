@@ -494,6 +494,8 @@ void _glfwWaitEventsNull(void)
 
 void _glfwWaitEventsTimeoutNull(double timeout)
 {
+    // There are no events to wake up for, but the caller may be pacing frames
+    _glfwPlatformSleep(timeout);
 }
 
 void _glfwPostEmptyEventNull(void)
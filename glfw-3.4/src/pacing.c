@@ -0,0 +1,206 @@
+//========================================================================
+// GLFW 3.4 - www.glfw.org
+//------------------------------------------------------------------------
+// Copyright (c) 2002-2006 Marcus Geelnard
+// Copyright (c) 2006-2019 Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+
+
+#include "internal.h"
+
+#include <assert.h>
+#include <float.h>
+#include <string.h>
+
+// The last part of a frame wait is spent spinning instead of sleeping, as the
+// platform wait may overshoot its timeout by about a scheduler tick
+#define _GLFW_PACING_SPIN_TIME 0.002
+
+// Returns whether the sync objects of the window's context may be used here
+//
+static GLFWbool fencesUsable(_GLFWwindow* window)
+{
+    return window->context.FenceSync &&
+           window == _glfwPlatformGetTls(&_glfw.contextSlot);
+}
+
+// Waits for the oldest pending fence of the window to signal and deletes it
+//
+static void waitOldestFence(_GLFWwindow* window)
+{
+    GLenum result;
+    GLsync fence = window->pacing.fences[0];
+
+    do
+    {
+        // Flush so the fence is guaranteed to reach the GPU at all
+        result = window->context.ClientWaitSync(fence,
+                                                GL_SYNC_FLUSH_COMMANDS_BIT,
+                                                100000000);
+    }
+    while (result == GL_TIMEOUT_EXPIRED);
+
+    if (result == GL_WAIT_FAILED)
+        _glfwInputError(GLFW_PLATFORM_ERROR, "Failed to wait for frame fence");
+
+    window->context.DeleteSync(fence);
+
+    window->pacing.fenceCount--;
+    memmove(window->pacing.fences, window->pacing.fences + 1,
+            window->pacing.fenceCount * sizeof(GLsync));
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Notifies shared code that a frame of the window has been submitted
+//
+void _glfwFramePresented(_GLFWwindow* window)
+{
+    GLsync fence;
+
+    if (window->pacing.framesInFlight == GLFW_DONT_CARE ||
+        !fencesUsable(window))
+    {
+        return;
+    }
+
+    // Applications that never wait for frames are still held to the limit
+    if (window->pacing.fenceCount > window->pacing.framesInFlight)
+        waitOldestFence(window);
+
+    fence = window->context.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    if (fence)
+        window->pacing.fences[window->pacing.fenceCount++] = fence;
+}
+
+// Deletes the pending fences of the window, if its context is current
+//
+void _glfwReleaseFrameFences(_GLFWwindow* window)
+{
+    int i;
+
+    if (!fencesUsable(window))
+        return;
+
+    for (i = 0;  i < window->pacing.fenceCount;  i++)
+        window->context.DeleteSync(window->pacing.fences[i]);
+
+    window->pacing.fenceCount = 0;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                        GLFW public API                       //////
+//////////////////////////////////////////////////////////////////////////
+
+GLFWAPI void glfwSetFramePacing(GLFWwindow* handle, double frameRate, int framesInFlight)
+{
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    _GLFW_REQUIRE_INIT();
+
+    if (frameRate == GLFW_DONT_CARE)
+        frameRate = 0.0;
+
+    if (frameRate != frameRate || frameRate < 0.0 || frameRate > DBL_MAX)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid frame rate %f", frameRate);
+        return;
+    }
+
+    if (framesInFlight != GLFW_DONT_CARE &&
+        (framesInFlight < 0 || framesInFlight > _GLFW_MAX_FRAME_FENCES))
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Invalid number of frames in flight %i", framesInFlight);
+        return;
+    }
+
+    if (framesInFlight == GLFW_DONT_CARE)
+        _glfwReleaseFrameFences(window);
+
+    window->pacing.period = frameRate > 0.0 ? 1.0 / frameRate : 0.0;
+    window->pacing.framesInFlight = framesInFlight;
+    window->pacing.deadline = 0;
+}
+
+GLFWAPI double glfwWaitForFrame(GLFWwindow* handle)
+{
+    uint64_t now, deadline, period;
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(0.0);
+
+    // The replay clock only advances with event processing, so waiting for it
+    // would never end
+    if (_glfw.capture.replaying)
+    {
+        glfwPollEvents();
+        return glfwGetTime();
+    }
+
+    if (window->pacing.framesInFlight != GLFW_DONT_CARE &&
+        fencesUsable(window))
+    {
+        while (window->pacing.fenceCount > window->pacing.framesInFlight)
+            waitOldestFence(window);
+    }
+
+    if (window->pacing.period > 0.0)
+    {
+        const uint64_t frequency = _glfwPlatformGetTimerFrequency();
+        const uint64_t spin = (uint64_t) (_GLFW_PACING_SPIN_TIME * frequency);
+
+        period = (uint64_t) (window->pacing.period * frequency);
+        now = _glfwPlatformGetTimerValue();
+        deadline = window->pacing.deadline + period;
+
+        // A frame that ran over by more than a period starts the schedule over
+        // instead of being followed by a burst of short ones
+        if (!window->pacing.deadline || now > deadline + period)
+            deadline = now;
+
+        window->pacing.deadline = deadline;
+
+        while (now < deadline)
+        {
+            if (deadline - now > spin)
+            {
+                _glfw.platform.waitEventsTimeout((double) (deadline - now - spin) /
+                                                 frequency);
+            }
+
+            now = _glfwPlatformGetTimerValue();
+        }
+    }
+
+    // Latch input as late as possible
+    glfwPollEvents();
+    return glfwGetTime();
+}
+
@@ -30,6 +30,7 @@
 #if defined(GLFW_BUILD_POSIX_TIMER)
 
 #include <unistd.h>
+#include <errno.h>
 #include <sys/time.h>
 
 
@@ -61,5 +62,24 @@ uint64_t _glfwPlatformGetTimerFrequency(void)
     return _glfw.timer.posix.frequency;
 }
 
+void _glfwPlatformSleep(double seconds)
+{
+    struct timespec ts;
+    ts.tv_sec = (time_t) seconds;
+    ts.tv_nsec = (long) ((seconds - ts.tv_sec) * 1e9);
+
+#if defined(_POSIX_MONOTONIC_CLOCK) && !defined(__APPLE__)
+    if (_glfw.timer.posix.clock == CLOCK_MONOTONIC)
+    {
+        while (clock_nanosleep(CLOCK_MONOTONIC, 0, &ts, &ts) == EINTR)
+            ;
+        return;
+    }
+#endif
+
+    while (nanosleep(&ts, &ts) == -1 && errno == EINTR)
+        ;
+}
+
 #endif // GLFW_BUILD_POSIX_TIMER
 
@@ -0,0 +1,329 @@
+//========================================================================
+// GLFW 3.4 - www.glfw.org
+//------------------------------------------------------------------------
+// Copyright (c) 2002-2006 Marcus Geelnard
+// Copyright (c) 2006-2019 Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+
+#include "internal.h"
+
+#include <assert.h>
+#include <float.h>
+#include <stdio.h>
+#include <string.h>
+
+// An input capture file is an eight byte header followed by fixed size records,
+// all values little-endian:
+//
+//   header   "GLFWINP" followed by the format version byte
+//   record   f64 time in seconds since recording started
+//            u8  event type, u8 action, u8 mods, u8 reserved
+//            i32 key, mouse button or code point
+//            i32 scancode
+//            f64 x, f64 y
+//
+#define _GLFW_CAPTURE_MAGIC       "GLFWINP"
+#define _GLFW_CAPTURE_VERSION     1
+#define _GLFW_CAPTURE_RECORD_SIZE 36
+#define _GLFW_CAPTURE_MOD_MASK    (GLFW_MOD_SHIFT | GLFW_MOD_CONTROL | \
+                                   GLFW_MOD_ALT | GLFW_MOD_SUPER | \
+                                   GLFW_MOD_CAPS_LOCK | GLFW_MOD_NUM_LOCK)
+
+static void putU32(unsigned char* p, uint32_t value)
+{
+    p[0] = (unsigned char) value;
+    p[1] = (unsigned char) (value >> 8);
+    p[2] = (unsigned char) (value >> 16);
+    p[3] = (unsigned char) (value >> 24);
+}
+
+static uint32_t getU32(const unsigned char* p)
+{
+    return (uint32_t) p[0] |
+           ((uint32_t) p[1] << 8) |
+           ((uint32_t) p[2] << 16) |
+           ((uint32_t) p[3] << 24);
+}
+
+static void putF64(unsigned char* p, double value)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    putU32(p, (uint32_t) bits);
+    putU32(p + 4, (uint32_t) (bits >> 32));
+}
+
+static double getF64(const unsigned char* p)
+{
+    double value;
+    const uint64_t bits = getU32(p) | ((uint64_t) getU32(p + 4) << 32);
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Reads the next record into the look-ahead event, flagging the end of the file
+//
+static void readNextEvent(void)
+{
+    unsigned char record[_GLFW_CAPTURE_RECORD_SIZE];
+    GLFWevent* event = &_glfw.capture.next;
+
+    if (fread(record, sizeof(record), 1, _glfw.capture.file) != 1)
+    {
+        _glfw.capture.hasNext = GLFW_FALSE;
+        _glfw.capture.finished = GLFW_TRUE;
+        return;
+    }
+
+    memset(event, 0, sizeof(GLFWevent));
+    _glfw.capture.nextTime = getF64(record);
+    event->type     = record[8];
+    event->action   = record[9];
+    event->mods     = record[10] & _GLFW_CAPTURE_MOD_MASK;
+    event->key      = (int) getU32(record + 12);
+    event->scancode = (int) getU32(record + 16);
+    event->x        = getF64(record + 20);
+    event->y        = getF64(record + 28);
+
+    // The key member carries the button or code point of those event types
+    event->button    = event->key;
+    event->codepoint = (unsigned int) event->key;
+
+    _glfw.capture.hasNext = GLFW_TRUE;
+}
+
+// Passes a replayed event to the shared input code as if the platform sent it
+//
+static void injectEvent(_GLFWwindow* window, const GLFWevent* event)
+{
+    switch (event->type)
+    {
+        case GLFW_EVENT_KEY:
+            if (event->key < GLFW_KEY_UNKNOWN || event->key > GLFW_KEY_LAST)
+                break;
+
+            // Repeats are derived from the key state again
+            _glfwInputKey(window, event->key, event->scancode,
+                          event->action == GLFW_RELEASE ? GLFW_RELEASE : GLFW_PRESS,
+                          event->mods);
+            break;
+        case GLFW_EVENT_CHAR:
+            _glfwInputChar(window, event->codepoint,
+                           event->mods, GLFW_TRUE);
+            break;
+        case GLFW_EVENT_MOUSE_BUTTON:
+            if (event->button < 0 || event->button > GLFW_MOUSE_BUTTON_LAST)
+                break;
+
+            _glfwInputMouseClick(window, event->button,
+                                 event->action == GLFW_RELEASE ? GLFW_RELEASE : GLFW_PRESS,
+                                 event->mods);
+            break;
+        case GLFW_EVENT_CURSOR_POS:
+            _glfwInputCursorPos(window, event->x, event->y);
+            break;
+        case GLFW_EVENT_CURSOR_ENTER:
+            _glfwInputCursorEnter(window, event->action ? GLFW_TRUE : GLFW_FALSE);
+            break;
+        case GLFW_EVENT_SCROLL:
+            _glfwInputScroll(window, event->x, event->y);
+            break;
+    }
+}
+
+// Opens a capture file and claims the capture state for the window
+//
+static GLFWbool beginCapture(_GLFWwindow* window, const char* path, const char* mode)
+{
+    if (_glfw.capture.recording || _glfw.capture.replaying)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Input is already being recorded or replayed");
+        return GLFW_FALSE;
+    }
+
+    _glfw.capture.file = fopen(path, mode);
+    if (!_glfw.capture.file)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Failed to open input capture file %s", path);
+        return GLFW_FALSE;
+    }
+
+    _glfw.capture.window = window;
+    _glfw.capture.finished = GLFW_FALSE;
+    _glfw.capture.hasNext = GLFW_FALSE;
+    return GLFW_TRUE;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Appends an input event of the recorded window to the capture file
+//
+void _glfwRecordEvent(_GLFWwindow* window, const GLFWevent* event)
+{
+    unsigned char record[_GLFW_CAPTURE_RECORD_SIZE];
+    int code = event->key;
+
+    if (!_glfw.capture.recording || window != _glfw.capture.window)
+        return;
+
+    if (event->type == GLFW_EVENT_MOUSE_BUTTON)
+        code = event->button;
+    else if (event->type == GLFW_EVENT_CHAR)
+        code = (int) event->codepoint;
+
+    memset(record, 0, sizeof(record));
+    putF64(record, (double) (event->time - _glfw.capture.start) /
+                   _glfwPlatformGetTimerFrequency());
+    record[8]  = (unsigned char) event->type;
+    record[9]  = (unsigned char) event->action;
+    record[10] = (unsigned char) event->mods;
+    putU32(record + 12, (uint32_t) code);
+    putU32(record + 16, (uint32_t) event->scancode);
+    putF64(record + 20, event->x);
+    putF64(record + 28, event->y);
+
+    fwrite(record, sizeof(record), 1, _glfw.capture.file);
+}
+
+// Steps the replay clock and injects every event that is now due
+//
+void _glfwAdvanceReplay(void)
+{
+    if (!_glfw.capture.replaying)
+        return;
+
+    _glfw.capture.time += _glfw.capture.timestep;
+
+    _glfw.capture.injecting = GLFW_TRUE;
+
+    while (_glfw.capture.hasNext &&
+           _glfw.capture.nextTime <= _glfw.capture.time)
+    {
+        GLFWevent event = _glfw.capture.next;
+        readNextEvent();
+        injectEvent(_glfw.capture.window, &event);
+    }
+
+    _glfw.capture.injecting = GLFW_FALSE;
+}
+
+// Ends any recording or replay in progress
+//
+void _glfwStopInputCapture(void)
+{
+    if (_glfw.capture.file)
+        fclose(_glfw.capture.file);
+
+    _glfw.capture.file = NULL;
+    _glfw.capture.window = NULL;
+    _glfw.capture.recording = GLFW_FALSE;
+    _glfw.capture.replaying = GLFW_FALSE;
+    _glfw.capture.injecting = GLFW_FALSE;
+    _glfw.capture.hasNext = GLFW_FALSE;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                        GLFW public API                       //////
+//////////////////////////////////////////////////////////////////////////
+
+GLFWAPI int glfwStartInputRecording(GLFWwindow* handle, const char* path)
+{
+    unsigned char header[8] = _GLFW_CAPTURE_MAGIC;
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+    assert(path != NULL);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+
+    if (!beginCapture(window, path, "wb"))
+        return GLFW_FALSE;
+
+    header[7] = _GLFW_CAPTURE_VERSION;
+    if (fwrite(header, sizeof(header), 1, _glfw.capture.file) != 1)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Failed to write input capture file %s", path);
+        _glfwStopInputCapture();
+        return GLFW_FALSE;
+    }
+
+    _glfw.capture.start = _glfwPlatformGetTimerValue();
+    _glfw.capture.recording = GLFW_TRUE;
+    return GLFW_TRUE;
+}
+
+GLFWAPI int glfwStartInputReplay(GLFWwindow* handle, const char* path, double timestep)
+{
+    unsigned char header[8];
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+    assert(path != NULL);
+    assert(timestep > 0.0);
+    assert(timestep <= DBL_MAX);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+
+    if (timestep != timestep || timestep <= 0.0 || timestep > DBL_MAX)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid replay time step %f", timestep);
+        return GLFW_FALSE;
+    }
+
+    if (!beginCapture(window, path, "rb"))
+        return GLFW_FALSE;
+
+    if (fread(header, sizeof(header), 1, _glfw.capture.file) != 1 ||
+        memcmp(header, _GLFW_CAPTURE_MAGIC, 7) != 0 ||
+        header[7] != _GLFW_CAPTURE_VERSION)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "File %s is not a supported input capture", path);
+        _glfwStopInputCapture();
+        return GLFW_FALSE;
+    }
+
+    _glfw.capture.time = 0.0;
+    _glfw.capture.timestep = timestep;
+    _glfw.capture.replaying = GLFW_TRUE;
+    readNextEvent();
+    return GLFW_TRUE;
+}
+
+GLFWAPI void glfwStopInputCapture(void)
+{
+    _GLFW_REQUIRE_INIT();
+    _glfwStopInputCapture();
+}
+
+GLFWAPI int glfwInputReplayFinished(void)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+    return _glfw.capture.replaying && _glfw.capture.finished;
+}
+
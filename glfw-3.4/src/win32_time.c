@@ -50,5 +50,10 @@ uint64_t _glfwPlatformGetTimerFrequency(void)
     return _glfw.timer.win32.frequency;
 }
 
+void _glfwPlatformSleep(double seconds)
+{
+    Sleep((DWORD) (seconds * 1e3));
+}
+
 #endif // GLFW_BUILD_WIN32_TIMER
 
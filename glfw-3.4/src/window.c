@@ -234,6 +234,8 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
     window->mousePassthrough = wndconfig.mousePassthrough;
     window->cursorMode       = GLFW_CURSOR_NORMAL;
 
+    window->pacing.framesInFlight = GLFW_DONT_CARE;
+
     window->doublebuffer = fbconfig.doublebuffer;
 
     window->minwidth    = GLFW_DONT_CARE;
@@ -244,6 +246,22 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
     window->denom       = GLFW_DONT_CARE;
     window->title       = _glfw_strdup(title);
 
+    if (wndconfig.eventQueueSize > 0)
+    {
+        uint32_t capacity = 1;
+        while (capacity < (uint32_t) wndconfig.eventQueueSize && capacity < 0x40000000u)
+            capacity *= 2;
+
+        window->eventQueue.events = _glfw_calloc(capacity, sizeof(GLFWevent));
+        if (!window->eventQueue.events)
+        {
+            glfwDestroyWindow((GLFWwindow*) window);
+            return NULL;
+        }
+
+        window->eventQueue.capacity = capacity;
+    }
+
     if (!_glfw.platform.createWindow(window, &wndconfig, &ctxconfig, &fbconfig))
     {
         glfwDestroyWindow((GLFWwindow*) window);
@@ -379,6 +397,9 @@ GLFWAPI void glfwWindowHint(int hint, int value)
         case GLFW_WIN32_SHOWDEFAULT:
             _glfw.hints.window.win32.showDefault = value ? GLFW_TRUE : GLFW_FALSE;
             return;
+        case GLFW_X11_COALESCE_MOTION:
+            _glfw.hints.window.x11.coalesceMotion = value ? GLFW_TRUE : GLFW_FALSE;
+            return;
         case GLFW_COCOA_GRAPHICS_SWITCHING:
             _glfw.hints.context.nsgl.offline = value ? GLFW_TRUE : GLFW_FALSE;
             return;
@@ -398,6 +419,9 @@ GLFWAPI void glfwWindowHint(int hint, int value)
         case GLFW_MOUSE_PASSTHROUGH:
             _glfw.hints.window.mousePassthrough = value ? GLFW_TRUE : GLFW_FALSE;
             return;
+        case GLFW_EVENT_QUEUE_SIZE:
+            _glfw.hints.window.eventQueueSize = value > 0 ? value : 0;
+            return;
         case GLFW_CLIENT_API:
             _glfw.hints.context.client = value;
             return;
@@ -481,7 +505,18 @@ GLFWAPI void glfwDestroyWindow(GLFWwindow* handle)
     // The window's context must not be current on another thread when the
     // window is destroyed
     if (window == _glfwPlatformGetTls(&_glfw.contextSlot))
+    {
+        _glfwReleaseFrameFences(window);
         glfwMakeContextCurrent(NULL);
+    }
+    else if (window->pacing.fenceCount)
+    {
+        // The frame fences can only be deleted with their context current
+        _GLFWwindow* previous = _glfwPlatformGetTls(&_glfw.contextSlot);
+        glfwMakeContextCurrent((GLFWwindow*) window);
+        _glfwReleaseFrameFences(window);
+        glfwMakeContextCurrent((GLFWwindow*) previous);
+    }
 
     _glfw.platform.destroyWindow(window);
 
@@ -495,6 +530,10 @@ GLFWAPI void glfwDestroyWindow(GLFWwindow* handle)
         *prev = window->next;
     }
 
+    if (window == _glfw.capture.window)
+        _glfwStopInputCapture();
+
+    _glfw_free(window->eventQueue.events);
     _glfw_free(window->title);
     _glfw_free(window);
 }
@@ -1140,11 +1179,20 @@ GLFWAPI void glfwPollEvents(void)
 {
     _GLFW_REQUIRE_INIT();
     _glfw.platform.pollEvents();
+    _glfwAdvanceReplay();
 }
 
 GLFWAPI void glfwWaitEvents(void)
 {
     _GLFW_REQUIRE_INIT();
+
+    // A replay always has input due on the next time step, so do not block
+    if (_glfw.capture.replaying)
+    {
+        glfwPollEvents();
+        return;
+    }
+
     _glfw.platform.waitEvents();
 }
 
@@ -1161,6 +1209,12 @@ GLFWAPI void glfwWaitEventsTimeout(double timeout)
         return;
     }
 
+    if (_glfw.capture.replaying)
+    {
+        glfwPollEvents();
+        return;
+    }
+
     _glfw.platform.waitEventsTimeout(timeout);
 }
 
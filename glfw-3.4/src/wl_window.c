@@ -1206,22 +1206,29 @@ static void handleEvents(double* timeout)
 {
 #if defined(GLFW_BUILD_LINUX_JOYSTICK)
     if (_glfw.joysticksInitialized)
-        _glfwDetectJoystickConnectionLinux();
+        _glfwDispatchJoystickEventsLinux();
 #endif
 
     GLFWbool event = GLFW_FALSE;
-    enum { DISPLAY_FD, KEYREPEAT_FD, CURSOR_FD, LIBDECOR_FD };
+    enum { DISPLAY_FD, KEYREPEAT_FD, CURSOR_FD, LIBDECOR_FD, JOYSTICK_FD };
     struct pollfd fds[] =
     {
         [DISPLAY_FD] = { wl_display_get_fd(_glfw.wl.display), POLLIN },
         [KEYREPEAT_FD] = { _glfw.wl.keyRepeatTimerfd, POLLIN },
         [CURSOR_FD] = { _glfw.wl.cursorTimerfd, POLLIN },
-        [LIBDECOR_FD] = { -1, POLLIN }
+        [LIBDECOR_FD] = { -1, POLLIN },
+        [JOYSTICK_FD] = { -1, POLLIN }
     };
 
     if (_glfw.wl.libdecor.context)
         fds[LIBDECOR_FD].fd = libdecor_get_fd(_glfw.wl.libdecor.context);
 
+#if defined(GLFW_BUILD_LINUX_JOYSTICK)
+    // The epoll set becomes readable on joystick input as well as hotplug
+    if (_glfw.joysticksInitialized)
+        fds[JOYSTICK_FD].fd = _glfw.linjs.epoll;
+#endif
+
     while (!event)
     {
         while (wl_display_prepare_read(_glfw.wl.display) != 0)
@@ -1294,6 +1301,14 @@ static void handleEvents(double* timeout)
             if (libdecor_dispatch(_glfw.wl.libdecor.context, 0) > 0)
                 event = GLFW_TRUE;
         }
+
+#if defined(GLFW_BUILD_LINUX_JOYSTICK)
+        if (fds[JOYSTICK_FD].revents & POLLIN)
+        {
+            _glfwDispatchJoystickEventsLinux();
+            event = GLFW_TRUE;
+        }
+#endif
     }
 }
 
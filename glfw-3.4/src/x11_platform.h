@@ -543,6 +543,12 @@ typedef struct _GLFWwindowX11
     // The last position the cursor was warped to by GLFW
     int             warpCursorPosX, warpCursorPosY;
 
+    // Whether cursor motion is merged into one update per event drain, and
+    // the merged position that has not been reported yet
+    GLFWbool        coalesceMotion;
+    GLFWbool        motionPending;
+    double          motionPosX, motionPosY;
+
     // The time of the last KeyPress event per keycode, for discarding
     // duplicate key events generated for some keys by ibus
     Time            keyPressTimes[256];
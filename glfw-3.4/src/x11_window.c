@@ -79,17 +79,23 @@ static GLFWbool waitForX11Event(double* timeout)
 //
 static GLFWbool waitForAnyEvent(double* timeout)
 {
-    enum { XLIB_FD, PIPE_FD, INOTIFY_FD };
+    enum { XLIB_FD, PIPE_FD, JOYSTICK_FD };
     struct pollfd fds[] =
     {
         [XLIB_FD] = { ConnectionNumber(_glfw.x11.display), POLLIN },
         [PIPE_FD] = { _glfw.x11.emptyEventPipe[0], POLLIN },
-        [INOTIFY_FD] = { -1, POLLIN }
+        [JOYSTICK_FD] = { -1, POLLIN }
     };
 
 #if defined(GLFW_BUILD_LINUX_JOYSTICK)
+    // The epoll set becomes readable on joystick input as well as hotplug
     if (_glfw.joysticksInitialized)
-        fds[INOTIFY_FD].fd = _glfw.linjs.inotify;
+    {
+        if (_glfw.linjs.epoll >= 0)
+            fds[JOYSTICK_FD].fd = _glfw.linjs.epoll;
+        else
+            fds[JOYSTICK_FD].fd = _glfw.linjs.inotify;
+    }
 #endif
 
     while (!XPending(_glfw.x11.display))
@@ -591,6 +597,7 @@ static GLFWbool createNativeWindow(_GLFWwindow* window,
                                            AllocNone);
 
     window->x11.transparent = _glfwIsVisualTransparentX11(visual);
+    window->x11.coalesceMotion = wndconfig->x11.coalesceMotion;
 
     XSetWindowAttributes wa = { 0 };
     wa.colormap = window->x11.colormap;
@@ -1141,6 +1148,49 @@ static void releaseMonitor(_GLFWwindow* window)
     }
 }
 
+// Returns the cursor position that relative motion should be added to
+//
+static void getMotionBase(_GLFWwindow* window, double* xpos, double* ypos)
+{
+    if (window->x11.motionPending)
+    {
+        *xpos = window->x11.motionPosX;
+        *ypos = window->x11.motionPosY;
+    }
+    else
+    {
+        *xpos = window->virtualCursorPosX;
+        *ypos = window->virtualCursorPosY;
+    }
+}
+
+// Reports a new cursor position, or holds on to it until the end of the event
+// drain if the window coalesces motion
+//
+static void inputCursorMotion(_GLFWwindow* window, double xpos, double ypos)
+{
+    if (!window->x11.coalesceMotion)
+    {
+        _glfwInputCursorPos(window, xpos, ypos);
+        return;
+    }
+
+    window->x11.motionPending = GLFW_TRUE;
+    window->x11.motionPosX = xpos;
+    window->x11.motionPosY = ypos;
+}
+
+// Reports the cursor position held back by inputCursorMotion, if any
+//
+static void flushCursorMotion(_GLFWwindow* window)
+{
+    if (!window->x11.motionPending)
+        return;
+
+    window->x11.motionPending = GLFW_FALSE;
+    _glfwInputCursorPos(window, window->x11.motionPosX, window->x11.motionPosY);
+}
+
 // Process the specified X event
 //
 static void processEvent(XEvent *event)
@@ -1194,8 +1244,8 @@ static void processEvent(XEvent *event)
                 if (re->valuators.mask_len)
                 {
                     const double* values = re->raw_values;
-                    double xpos = window->virtualCursorPosX;
-                    double ypos = window->virtualCursorPosY;
+                    double xpos, ypos;
+                    getMotionBase(window, &xpos, &ypos);
 
                     if (XIMaskIsSet(re->valuators.mask, 0))
                     {
@@ -1206,7 +1256,7 @@ static void processEvent(XEvent *event)
                     if (XIMaskIsSet(re->valuators.mask, 1))
                         ypos += *values;
 
-                    _glfwInputCursorPos(window, xpos, ypos);
+                    inputCursorMotion(window, xpos, ypos);
                 }
             }
 
@@ -1232,6 +1282,10 @@ static void processEvent(XEvent *event)
         return;
     }
 
+    // Merged motion must be reported before anything that happened after it
+    if (event->type != MotionNotify)
+        flushCursorMotion(window);
+
     switch (event->type)
     {
         case ReparentNotify:
@@ -1469,13 +1523,13 @@ static void processEvent(XEvent *event)
 
                     const int dx = x - window->x11.lastCursorPosX;
                     const int dy = y - window->x11.lastCursorPosY;
+                    double xpos, ypos;
+                    getMotionBase(window, &xpos, &ypos);
 
-                    _glfwInputCursorPos(window,
-                                        window->virtualCursorPosX + dx,
-                                        window->virtualCursorPosY + dy);
+                    inputCursorMotion(window, xpos + dx, ypos + dy);
                 }
                 else
-                    _glfwInputCursorPos(window, x, y);
+                    inputCursorMotion(window, x, y);
             }
 
             window->x11.lastCursorPosX = x;
@@ -2785,7 +2839,7 @@ void _glfwPollEventsX11(void)
 
 #if defined(GLFW_BUILD_LINUX_JOYSTICK)
     if (_glfw.joysticksInitialized)
-        _glfwDetectJoystickConnectionLinux();
+        _glfwDispatchJoystickEventsLinux();
 #endif
     XPending(_glfw.x11.display);
 
@@ -2796,6 +2850,9 @@ void _glfwPollEventsX11(void)
         processEvent(&event);
     }
 
+    for (_GLFWwindow* window = _glfw.windowListHead;  window;  window = window->next)
+        flushCursorMotion(window);
+
     _GLFWwindow* window = _glfw.x11.disabledCursorWindow;
     if (window)
     {
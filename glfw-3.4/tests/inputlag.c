@@ -53,9 +53,11 @@
 
 void usage(void)
 {
-    printf("Usage: inputlag [-h] [-f]\n");
+    printf("Usage: inputlag [-h] [-f] [-r RATE] [-q FRAMES]\n");
     printf("Options:\n");
     printf("  -f create full screen window\n");
+    printf("  -r RATE pace frames to RATE frames per second\n");
+    printf("  -q FRAMES allow at most FRAMES frames in flight on the GPU\n");
     printf("  -h show this help\n");
 }
 
@@ -91,6 +93,14 @@ void update_vsync()
     glfwSwapInterval(enable_vsync == nk_true ? 1 : 0);
 }
 
+int pacing_rate = 0;
+int pacing_frames = GLFW_DONT_CARE;
+
+void update_pacing(GLFWwindow* window)
+{
+    glfwSetFramePacing(window, pacing_rate, pacing_frames);
+}
+
 int swap_clear = nk_false;
 int swap_finish = nk_true;
 int swap_occlusion_query = nk_false;
@@ -164,7 +174,7 @@ int main(int argc, char** argv)
 
     int show_forecasts = nk_true;
 
-    while ((ch = getopt(argc, argv, "fh")) != -1)
+    while ((ch = getopt(argc, argv, "fhr:q:")) != -1)
     {
         switch (ch)
         {
@@ -175,6 +185,14 @@ int main(int argc, char** argv)
             case 'f':
                 fullscreen = GLFW_TRUE;
                 break;
+
+            case 'r':
+                pacing_rate = atoi(optarg);
+                break;
+
+            case 'q':
+                pacing_frames = atoi(optarg);
+                break;
         }
     }
 
@@ -215,6 +233,7 @@ int main(int argc, char** argv)
     glfwMakeContextCurrent(window);
     gladLoadGL(glfwGetProcAddress);
     update_vsync();
+    update_pacing(window);
 
     last_time = glfwGetTime();
 
@@ -230,7 +249,8 @@ int main(int argc, char** argv)
         int width, height;
         struct nk_rect area;
 
-        glfwPollEvents();
+        // Waits for the frame rate and queue limits, then polls events
+        glfwWaitForFrame(window);
         sample_input(window);
 
         glfwGetWindowSize(window, &width, &height);
@@ -279,6 +299,15 @@ int main(int argc, char** argv)
             if (nk_checkbox_label(nk, "Enable vsync", &enable_vsync))
                 update_vsync();
 
+            nk_label(nk, "Frame pacing (0 = off, -1 = driver):", align_left);
+            {
+                const int rate = pacing_rate, frames = pacing_frames;
+                nk_property_int(nk, "Target FPS", 0, &pacing_rate, 1000, 10, 1);
+                nk_property_int(nk, "Frames in flight", -1, &pacing_frames, 8, 1, 1);
+                if (pacing_rate != rate || pacing_frames != frames)
+                    update_pacing(window);
+            }
+
             nk_label(nk, "", 0); // separator
 
             nk_label(nk, "After swap:", align_left);
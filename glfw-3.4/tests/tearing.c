@@ -68,16 +68,21 @@ static const char* fragment_shader_text =
 
 static int swap_tear;
 static int swap_interval;
+static int target_rate;
 static double frame_rate;
+static double frame_jitter;
 
 static void update_window_title(GLFWwindow* window)
 {
     char title[256];
 
-    snprintf(title, sizeof(title), "Tearing detector (interval %i%s, %0.1f Hz)",
+    snprintf(title, sizeof(title),
+             "Tearing detector (interval %i%s, target %i Hz, %0.1f Hz, jitter %0.2f ms)",
              swap_interval,
              (swap_tear && swap_interval < 0) ? " (swap tear)" : "",
-             frame_rate);
+             target_rate,
+             frame_rate,
+             frame_jitter * 1000.0);
 
     glfwSetWindowTitle(window, title);
 }
@@ -89,6 +94,13 @@ static void set_swap_interval(GLFWwindow* window, int interval)
     update_window_title(window);
 }
 
+static void set_target_rate(GLFWwindow* window, int rate)
+{
+    target_rate = rate;
+    glfwSetFramePacing(window, target_rate, 1);
+    update_window_title(window);
+}
+
 static void error_callback(int error, const char* description)
 {
     fprintf(stderr, "Error: %s\n", description);
@@ -123,6 +135,17 @@ static void key_callback(GLFWwindow* window, int key, int scancode, int action,
             break;
         }
 
+        case GLFW_KEY_RIGHT:
+            set_target_rate(window, target_rate + 10);
+            break;
+
+        case GLFW_KEY_LEFT:
+        {
+            if (target_rate - 10 >= 0)
+                set_target_rate(window, target_rate - 10);
+            break;
+        }
+
         case GLFW_KEY_ESCAPE:
             glfwSetWindowShouldClose(window, 1);
             break;
@@ -156,7 +179,8 @@ static void key_callback(GLFWwindow* window, int key, int scancode, int action,
 int main(int argc, char** argv)
 {
     unsigned long frame_count = 0;
-    double last_time, current_time;
+    double last_time, current_time, frame_time;
+    double min_interval = 0.0, max_interval = 0.0;
     GLFWwindow* window;
     GLuint vertex_buffer, vertex_shader, fragment_shader, program;
     GLint mvp_location, vpos_location;
@@ -179,8 +203,10 @@ int main(int argc, char** argv)
     glfwMakeContextCurrent(window);
     gladLoadGL(glfwGetProcAddress);
     set_swap_interval(window, 0);
+    set_target_rate(window, 0);
 
     last_time = glfwGetTime();
+    frame_time = last_time;
     frame_rate = 0.0;
     swap_tear = (glfwExtensionSupported("WGL_EXT_swap_control_tear") ||
                  glfwExtensionSupported("GLX_EXT_swap_control_tear"));
@@ -231,14 +257,20 @@ int main(int argc, char** argv)
         glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
 
         glfwSwapBuffers(window);
-        glfwPollEvents();
+        current_time = glfwWaitForFrame(window);
+
+        if (frame_count == 0 || current_time - frame_time < min_interval)
+            min_interval = current_time - frame_time;
+        if (frame_count == 0 || current_time - frame_time > max_interval)
+            max_interval = current_time - frame_time;
+        frame_time = current_time;
 
         frame_count++;
 
-        current_time = glfwGetTime();
         if (current_time - last_time > 1.0)
         {
             frame_rate = frame_count / (current_time - last_time);
+            frame_jitter = max_interval - min_interval;
             frame_count = 0;
             last_time = current_time;
             update_window_title(window);
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "setup.hpp"
+#include <cmath>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// float fallbacks are evaluated in double so that they match the libm results within an ulp
+	template<typename T>
+	struct constexpr_evaluation_type
+	{
+		typedef T type;
+	};
+
+	template<>
+	struct constexpr_evaluation_type<float>
+	{
+		typedef double type;
+	};
+
+	// Newton iteration from above, it decreases until it reaches sqrt(x)
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T constexpr_sqrt(T x)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'constexpr_sqrt' accepts only floating-point inputs");
+
+		if(!(x >= static_cast<T>(0)))
+			return std::numeric_limits<T>::quiet_NaN();
+		if(x == static_cast<T>(0) || x > std::numeric_limits<T>::max())
+			return x;
+
+		typedef typename constexpr_evaluation_type<T>::type U;
+		U const v = static_cast<U>(x);
+		U Result = v > static_cast<U>(1) ? v : static_cast<U>(1);
+		for(;;)
+		{
+			U const Next = (Result + v / Result) * static_cast<U>(0.5);
+			if(Next >= Result)
+				return static_cast<T>(Result);
+			Result = Next;
+		}
+	}
+
+	// Taylor series of sin(x) for x in [-pi/2, pi/2], summed until the terms no longer change the result
+	template<typename U>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR U constexpr_sin_reduced(U x)
+	{
+		U const x2 = x * x;
+		U Term = x;
+		U Result = x;
+		for(int i = 1;; ++i)
+		{
+			Term *= -x2 / static_cast<U>((2 * i) * (2 * i + 1));
+			U const Next = Result + Term;
+			if(Next == Result)
+				return Result;
+			Result = Next;
+		}
+	}
+
+	// Reduction to [-pi, pi]. It's exact enough for angles of a few turns, not for arguments of large magnitudes.
+	template<typename U>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR U constexpr_reduce_angle(U x)
+	{
+		U const TwoPi = static_cast<U>(6.28318530717958647692528676655900576);
+		long long const Turns = static_cast<long long>(x / TwoPi + (x < static_cast<U>(0) ? static_cast<U>(-0.5) : static_cast<U>(0.5)));
+		return x - static_cast<U>(Turns) * TwoPi;
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T constexpr_sin(T x)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'constexpr_sin' accepts only floating-point inputs");
+
+		typedef typename constexpr_evaluation_type<T>::type U;
+		if(!(x > static_cast<T>(-1e15) && x < static_cast<T>(1e15)))
+			return std::numeric_limits<T>::quiet_NaN();
+
+		U const Pi = static_cast<U>(3.14159265358979323846264338327950288);
+		U const HalfPi = static_cast<U>(1.57079632679489661923132169163975144);
+		U const a = constexpr_reduce_angle(static_cast<U>(x));
+		if(a > HalfPi)
+			return static_cast<T>(constexpr_sin_reduced(Pi - a));
+		if(a < -HalfPi)
+			return static_cast<T>(constexpr_sin_reduced(-Pi - a));
+		return static_cast<T>(constexpr_sin_reduced(a));
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T constexpr_cos(T x)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'constexpr_cos' accepts only floating-point inputs");
+
+		typedef typename constexpr_evaluation_type<T>::type U;
+		if(!(x > static_cast<T>(-1e15) && x < static_cast<T>(1e15)))
+			return std::numeric_limits<T>::quiet_NaN();
+
+		U const HalfPi = static_cast<U>(1.57079632679489661923132169163975144);
+		U const a = constexpr_reduce_angle(static_cast<U>(x));
+		return static_cast<T>(constexpr_sin_reduced(HalfPi - (a < static_cast<U>(0) ? -a : a)));
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T constexpr_tan(T x)
+	{
+		typedef typename constexpr_evaluation_type<T>::type U;
+		return static_cast<T>(constexpr_sin(static_cast<U>(x)) / constexpr_cos(static_cast<U>(x)));
+	}
+
+	// Use the fallbacks above during constant evaluation and libm otherwise
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX20 T eval_sin(T x)
+	{
+#		if GLM_HAS_CONSTANT_EVALUATED
+			if(std::is_constant_evaluated())
+				return constexpr_sin(x);
+#		endif
+		return std::sin(x);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX20 T eval_cos(T x)
+	{
+#		if GLM_HAS_CONSTANT_EVALUATED
+			if(std::is_constant_evaluated())
+				return constexpr_cos(x);
+#		endif
+		return std::cos(x);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX20 T eval_tan(T x)
+	{
+#		if GLM_HAS_CONSTANT_EVALUATED
+			if(std::is_constant_evaluated())
+				return constexpr_tan(x);
+#		endif
+		return std::tan(x);
+	}
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,47 @@
+/// @ref core
+/// @file glm/detail/func_trigonometric_simd.inl
+
+#include "../simd/trigonometric.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// The range reduction is exact up to |x| = 8192, larger angles go through libm
+	GLM_FUNC_QUALIFIER bool compute_trigonometric_in_range(glm_f32vec4 x)
+	{
+		return _mm_movemask_ps(_mm_cmpgt_ps(glm_vec4_abs(x), _mm_set1_ps(8192.0f))) == 0;
+	}
+
+	template<qualifier Q>
+	struct compute_sin<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(!compute_trigonometric_in_range(v.data))
+				return detail::functor1<vec, 4, float, float, Q>::call(std::sin, v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_sin(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_cos<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(!compute_trigonometric_in_range(v.data))
+				return detail::functor1<vec, 4, float, float, Q>::call(std::cos, v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_cos(v.data);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
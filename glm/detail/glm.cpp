@@ -259,5 +259,82 @@ template struct tdualquat<float64, mediump>;
 template struct tdualquat<float32, highp>;
 template struct tdualquat<float64, highp>;
 
+#if GLM_CONFIG_EXTERN_TEMPLATE == GLM_ENABLE
+// matrix functions declared extern template by GLM_FORCE_EXTERN_TEMPLATE
+template mat<3, 3, float32, highp> operator*(mat<3, 3, float32, highp> const&, mat<3, 3, float32, highp> const&);
+template vec<3, float32, highp> operator*(mat<3, 3, float32, highp> const&, vec<3, float32, highp> const&);
+template vec<3, float32, highp> operator*(vec<3, float32, highp> const&, mat<3, 3, float32, highp> const&);
+template mat<3, 3, float32, highp> transpose(mat<3, 3, float32, highp> const&);
+template float32 determinant(mat<3, 3, float32, highp> const&);
+template mat<3, 3, float32, highp> inverse(mat<3, 3, float32, highp> const&);
+
+template mat<3, 3, float64, highp> operator*(mat<3, 3, float64, highp> const&, mat<3, 3, float64, highp> const&);
+template vec<3, float64, highp> operator*(mat<3, 3, float64, highp> const&, vec<3, float64, highp> const&);
+template vec<3, float64, highp> operator*(vec<3, float64, highp> const&, mat<3, 3, float64, highp> const&);
+template mat<3, 3, float64, highp> transpose(mat<3, 3, float64, highp> const&);
+template float64 determinant(mat<3, 3, float64, highp> const&);
+template mat<3, 3, float64, highp> inverse(mat<3, 3, float64, highp> const&);
+
+template mat<4, 4, float32, highp> operator*(mat<4, 4, float32, highp> const&, mat<4, 4, float32, highp> const&);
+template vec<4, float32, highp> operator*(mat<4, 4, float32, highp> const&, vec<4, float32, highp> const&);
+template vec<4, float32, highp> operator*(vec<4, float32, highp> const&, mat<4, 4, float32, highp> const&);
+template mat<4, 4, float32, highp> transpose(mat<4, 4, float32, highp> const&);
+template float32 determinant(mat<4, 4, float32, highp> const&);
+template mat<4, 4, float32, highp> inverse(mat<4, 4, float32, highp> const&);
+
+template mat<4, 4, float64, highp> operator*(mat<4, 4, float64, highp> const&, mat<4, 4, float64, highp> const&);
+template vec<4, float64, highp> operator*(mat<4, 4, float64, highp> const&, vec<4, float64, highp> const&);
+template vec<4, float64, highp> operator*(vec<4, float64, highp> const&, mat<4, 4, float64, highp> const&);
+template mat<4, 4, float64, highp> transpose(mat<4, 4, float64, highp> const&);
+template float64 determinant(mat<4, 4, float64, highp> const&);
+template mat<4, 4, float64, highp> inverse(mat<4, 4, float64, highp> const&);
+
+// aligned types declared extern template by GLM_FORCE_EXTERN_TEMPLATE
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+template struct vec<2, float32, aligned_highp>;
+template struct vec<2, float64, aligned_highp>;
+template struct vec<3, float32, aligned_highp>;
+template struct vec<3, float64, aligned_highp>;
+template struct vec<4, float32, aligned_highp>;
+template struct vec<4, float64, aligned_highp>;
+
+template struct mat<3, 3, float32, aligned_highp>;
+template struct mat<3, 3, float64, aligned_highp>;
+template struct mat<4, 4, float32, aligned_highp>;
+template struct mat<4, 4, float64, aligned_highp>;
+
+template struct qua<float32, aligned_highp>;
+template struct qua<float64, aligned_highp>;
+
+template mat<3, 3, float32, aligned_highp> operator*(mat<3, 3, float32, aligned_highp> const&, mat<3, 3, float32, aligned_highp> const&);
+template vec<3, float32, aligned_highp> operator*(mat<3, 3, float32, aligned_highp> const&, vec<3, float32, aligned_highp> const&);
+template vec<3, float32, aligned_highp> operator*(vec<3, float32, aligned_highp> const&, mat<3, 3, float32, aligned_highp> const&);
+template mat<3, 3, float32, aligned_highp> transpose(mat<3, 3, float32, aligned_highp> const&);
+template float32 determinant(mat<3, 3, float32, aligned_highp> const&);
+template mat<3, 3, float32, aligned_highp> inverse(mat<3, 3, float32, aligned_highp> const&);
+
+template mat<3, 3, float64, aligned_highp> operator*(mat<3, 3, float64, aligned_highp> const&, mat<3, 3, float64, aligned_highp> const&);
+template vec<3, float64, aligned_highp> operator*(mat<3, 3, float64, aligned_highp> const&, vec<3, float64, aligned_highp> const&);
+template vec<3, float64, aligned_highp> operator*(vec<3, float64, aligned_highp> const&, mat<3, 3, float64, aligned_highp> const&);
+template mat<3, 3, float64, aligned_highp> transpose(mat<3, 3, float64, aligned_highp> const&);
+template float64 determinant(mat<3, 3, float64, aligned_highp> const&);
+template mat<3, 3, float64, aligned_highp> inverse(mat<3, 3, float64, aligned_highp> const&);
+
+template mat<4, 4, float32, aligned_highp> operator*(mat<4, 4, float32, aligned_highp> const&, mat<4, 4, float32, aligned_highp> const&);
+template vec<4, float32, aligned_highp> operator*(mat<4, 4, float32, aligned_highp> const&, vec<4, float32, aligned_highp> const&);
+template vec<4, float32, aligned_highp> operator*(vec<4, float32, aligned_highp> const&, mat<4, 4, float32, aligned_highp> const&);
+template mat<4, 4, float32, aligned_highp> transpose(mat<4, 4, float32, aligned_highp> const&);
+template float32 determinant(mat<4, 4, float32, aligned_highp> const&);
+template mat<4, 4, float32, aligned_highp> inverse(mat<4, 4, float32, aligned_highp> const&);
+
+template mat<4, 4, float64, aligned_highp> operator*(mat<4, 4, float64, aligned_highp> const&, mat<4, 4, float64, aligned_highp> const&);
+template vec<4, float64, aligned_highp> operator*(mat<4, 4, float64, aligned_highp> const&, vec<4, float64, aligned_highp> const&);
+template vec<4, float64, aligned_highp> operator*(vec<4, float64, aligned_highp> const&, mat<4, 4, float64, aligned_highp> const&);
+template mat<4, 4, float64, aligned_highp> transpose(mat<4, 4, float64, aligned_highp> const&);
+template float64 determinant(mat<4, 4, float64, aligned_highp> const&);
+template mat<4, 4, float64, aligned_highp> inverse(mat<4, 4, float64, aligned_highp> const&);
+#endif//GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#endif//GLM_CONFIG_EXTERN_TEMPLATE == GLM_ENABLE
+
 }//namespace glm
 
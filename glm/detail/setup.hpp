@@ -335,6 +335,19 @@
 #	define GLM_IF_CONSTEXPR if
 #endif
 
+// P0595 std::is_constant_evaluated, functions calling libm are constexpr using the fallbacks of compute_constexpr.hpp
+#if GLM_HAS_CONSTEXPR && (GLM_LANG & GLM_LANG_CXX20_FLAG)
+#	include <type_traits>
+#endif
+
+#if GLM_HAS_CONSTEXPR && (GLM_LANG & GLM_LANG_CXX20_FLAG) && defined(__cpp_lib_is_constant_evaluated)
+#	define GLM_HAS_CONSTANT_EVALUATED 1
+#	define GLM_CONSTEXPR_CXX20 constexpr
+#else
+#	define GLM_HAS_CONSTANT_EVALUATED 0
+#	define GLM_CONSTEXPR_CXX20
+#endif
+
 // [nodiscard]
 #if GLM_LANG & GLM_LANG_CXX17_FLAG
 #	define GLM_NODISCARD [[nodiscard]]
@@ -841,6 +854,16 @@ namespace detail
 #	define GLM_CONFIG_CTOR_INIT GLM_CTOR_INIT_DISABLE
 #endif
 
+///////////////////////////////////////////////////////////////////////////////////
+// Declare the common vec, mat and qua types extern template, they are instantiated
+// once by the glm library (glm/detail/glm.cpp) which needs to be linked
+
+#if defined(GLM_FORCE_EXTERN_TEMPLATE) && (GLM_LANG & GLM_LANG_CXX11_FLAG) && !(GLM_COMPILER & (GLM_COMPILER_CUDA | GLM_COMPILER_HIP))
+#	define GLM_CONFIG_EXTERN_TEMPLATE GLM_ENABLE
+#else
+#	define GLM_CONFIG_EXTERN_TEMPLATE GLM_DISABLE
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////////
 // Use SIMD instruction sets
 
@@ -1172,6 +1195,12 @@ namespace detail
 #		endif
 #	endif
 
+#	if GLM_CONFIG_EXTERN_TEMPLATE == GLM_ENABLE
+#		pragma message("GLM: GLM_FORCE_EXTERN_TEMPLATE is defined. Common types are instantiated by the glm library.")
+#	elif defined(GLM_FORCE_EXTERN_TEMPLATE)
+#		pragma message("GLM: GLM_FORCE_EXTERN_TEMPLATE is defined but is disabled. It requires C++11.")
+#	endif
+
 #	if GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_ZO_BIT
 #		pragma message("GLM: GLM_FORCE_DEPTH_ZERO_TO_ONE is defined. Using zero to one depth clip space.")
 #	else
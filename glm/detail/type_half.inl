@@ -28,6 +28,34 @@ namespace detail
 		unsigned int i;
 	};
 
+#	if GLM_HAS_HALF_INTRINSICS && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+
+	// F16C, rounds to nearest even
+	GLM_FUNC_QUALIFIER float toFloat32(hdata value)
+	{
+		return _cvtsh_ss(static_cast<unsigned short>(value));
+	}
+
+	GLM_FUNC_QUALIFIER hdata toFloat16(float const& f)
+	{
+		return static_cast<hdata>(_cvtss_sh(f, _MM_FROUND_TO_NEAREST_INT));
+	}
+
+#	elif GLM_HAS_HALF_INTRINSICS && (GLM_ARCH & GLM_ARCH_NEON_BIT)
+
+	// NEON fp16 conversion in lane 0, rounds to nearest even
+	GLM_FUNC_QUALIFIER float toFloat32(hdata value)
+	{
+		return vgetq_lane_f32(vcvt_f32_f16(vreinterpret_f16_s16(vdup_n_s16(value))), 0);
+	}
+
+	GLM_FUNC_QUALIFIER hdata toFloat16(float const& f)
+	{
+		return vget_lane_s16(vreinterpret_s16_f16(vcvt_f16_f32(vdupq_n_f32(f))), 0);
+	}
+
+#	else
+
 	GLM_FUNC_QUALIFIER float toFloat32(hdata value)
 	{
 		int s = (value >> 15) & 0x00000001;
@@ -237,5 +265,7 @@ namespace detail
 		}
 	}
 
+#	endif//GLM_HAS_HALF_INTRINSICS
+
 }//namespace detail
 }//namespace glm
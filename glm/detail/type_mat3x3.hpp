@@ -182,3 +182,18 @@ namespace glm
 #ifndef GLM_EXTERNAL_TEMPLATE
 #include "type_mat3x3.inl"
 #endif
+
+#if GLM_CONFIG_EXTERN_TEMPLATE == GLM_ENABLE
+namespace glm
+{
+	extern template struct mat<3, 3, float, packed_highp>;
+	extern template struct mat<3, 3, double, packed_highp>;
+
+	extern template mat<3, 3, float, packed_highp> operator*(mat<3, 3, float, packed_highp> const&, mat<3, 3, float, packed_highp> const&);
+	extern template vec<3, float, packed_highp> operator*(mat<3, 3, float, packed_highp> const&, vec<3, float, packed_highp> const&);
+	extern template vec<3, float, packed_highp> operator*(vec<3, float, packed_highp> const&, mat<3, 3, float, packed_highp> const&);
+	extern template mat<3, 3, double, packed_highp> operator*(mat<3, 3, double, packed_highp> const&, mat<3, 3, double, packed_highp> const&);
+	extern template vec<3, double, packed_highp> operator*(mat<3, 3, double, packed_highp> const&, vec<3, double, packed_highp> const&);
+	extern template vec<3, double, packed_highp> operator*(vec<3, double, packed_highp> const&, mat<3, 3, double, packed_highp> const&);
+}//namespace glm
+#endif//GLM_CONFIG_EXTERN_TEMPLATE
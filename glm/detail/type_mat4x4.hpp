@@ -187,3 +187,18 @@ namespace glm
 #ifndef GLM_EXTERNAL_TEMPLATE
 #include "type_mat4x4.inl"
 #endif//GLM_EXTERNAL_TEMPLATE
+
+#if GLM_CONFIG_EXTERN_TEMPLATE == GLM_ENABLE
+namespace glm
+{
+	extern template struct mat<4, 4, float, packed_highp>;
+	extern template struct mat<4, 4, double, packed_highp>;
+
+	extern template mat<4, 4, float, packed_highp> operator*(mat<4, 4, float, packed_highp> const&, mat<4, 4, float, packed_highp> const&);
+	extern template vec<4, float, packed_highp> operator*(mat<4, 4, float, packed_highp> const&, vec<4, float, packed_highp> const&);
+	extern template vec<4, float, packed_highp> operator*(vec<4, float, packed_highp> const&, mat<4, 4, float, packed_highp> const&);
+	extern template mat<4, 4, double, packed_highp> operator*(mat<4, 4, double, packed_highp> const&, mat<4, 4, double, packed_highp> const&);
+	extern template vec<4, double, packed_highp> operator*(mat<4, 4, double, packed_highp> const&, vec<4, double, packed_highp> const&);
+	extern template vec<4, double, packed_highp> operator*(vec<4, double, packed_highp> const&, mat<4, 4, double, packed_highp> const&);
+}//namespace glm
+#endif//GLM_CONFIG_EXTERN_TEMPLATE
@@ -191,3 +191,15 @@ namespace glm
 #ifndef GLM_EXTERNAL_TEMPLATE
 #include "type_quat.inl"
 #endif//GLM_EXTERNAL_TEMPLATE
+
+#if GLM_CONFIG_EXTERN_TEMPLATE == GLM_ENABLE
+namespace glm
+{
+	extern template struct qua<float, packed_highp>;
+	extern template struct qua<double, packed_highp>;
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		extern template struct qua<float, aligned_highp>;
+		extern template struct qua<double, aligned_highp>;
+#	endif
+}//namespace glm
+#endif//GLM_CONFIG_EXTERN_TEMPLATE
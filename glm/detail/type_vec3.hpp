@@ -445,3 +445,11 @@ namespace glm
 #ifndef GLM_EXTERNAL_TEMPLATE
 #include "type_vec3.inl"
 #endif//GLM_EXTERNAL_TEMPLATE
+
+#if GLM_CONFIG_EXTERN_TEMPLATE == GLM_ENABLE
+namespace glm
+{
+	extern template struct vec<3, float, packed_highp>;
+	extern template struct vec<3, double, packed_highp>;
+}//namespace glm
+#endif//GLM_CONFIG_EXTERN_TEMPLATE
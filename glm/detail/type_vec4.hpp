@@ -512,3 +512,11 @@ namespace glm
 #ifndef GLM_EXTERNAL_TEMPLATE
 #include "type_vec4.inl"
 #endif//GLM_EXTERNAL_TEMPLATE
+
+#if GLM_CONFIG_EXTERN_TEMPLATE == GLM_ENABLE
+namespace glm
+{
+	extern template struct vec<4, float, packed_highp>;
+	extern template struct vec<4, double, packed_highp>;
+}//namespace glm
+#endif//GLM_CONFIG_EXTERN_TEMPLATE
@@ -200,6 +200,7 @@
 #include "./gtx/color_encoding.hpp"
 #include "./gtx/color_space.hpp"
 #include "./gtx/color_space_YCoCg.hpp"
+#include "./gtx/color_space_buffer.hpp"
 #include "./gtx/common.hpp"
 #include "./gtx/compatibility.hpp"
 #include "./gtx/component_wise.hpp"
@@ -223,6 +224,7 @@
 #include "./gtx/intersect.hpp"
 #include "./gtx/io.hpp"
 #include "./gtx/log_base.hpp"
+#include "./gtx/matrix_affine.hpp"
 #include "./gtx/matrix_cross_product.hpp"
 #include "./gtx/matrix_decompose.hpp"
 #include "./gtx/matrix_factorisation.hpp"
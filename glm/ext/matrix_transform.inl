@@ -1,5 +1,17 @@
-namespace glm
+namespace glm{
+namespace detail
 {
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX20 vec<3, T, Q> eval_normalize(vec<3, T, Q> const& v)
+	{
+#		if GLM_HAS_CONSTANT_EVALUATED
+			if(std::is_constant_evaluated())
+				return v * (static_cast<T>(1) / constexpr_sqrt(dot(v, v)));
+#		endif
+		return normalize(v);
+	}
+}//namespace detail
+
 	template<typename genType>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genType identity()
 	{
@@ -15,13 +27,13 @@ namespace glm
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> rotate(mat<4, 4, T, Q> const& m, T angle, vec<3, T, Q> const& v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX20 mat<4, 4, T, Q> rotate(mat<4, 4, T, Q> const& m, T angle, vec<3, T, Q> const& v)
 	{
 		T const a = angle;
-		T const c = cos(a);
-		T const s = sin(a);
+		T const c = detail::eval_cos(a);
+		T const s = detail::eval_sin(a);
 
-		vec<3, T, Q> axis(normalize(v));
+		vec<3, T, Q> axis(detail::eval_normalize(v));
 		vec<3, T, Q> temp((T(1) - c) * axis);
 
 		mat<4, 4, T, Q> Rotate;
@@ -75,13 +87,12 @@ namespace glm
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> scale(mat<4, 4, T, Q> const& m, vec<3, T, Q> const& v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR mat<4, 4, T, Q> scale(mat<4, 4, T, Q> const& m, vec<3, T, Q> const& v)
 	{
-		mat<4, 4, T, Q> Result;
+		mat<4, 4, T, Q> Result(m);
 		Result[0] = m[0] * v[0];
 		Result[1] = m[1] * v[1];
 		Result[2] = m[2] * v[2];
-		Result[3] = m[3];
 		return Result;
 	}
 
@@ -150,10 +161,10 @@ namespace glm
     }
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> lookAtRH(vec<3, T, Q> const& eye, vec<3, T, Q> const& center, vec<3, T, Q> const& up)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX20 mat<4, 4, T, Q> lookAtRH(vec<3, T, Q> const& eye, vec<3, T, Q> const& center, vec<3, T, Q> const& up)
 	{
-		vec<3, T, Q> const f(normalize(center - eye));
-		vec<3, T, Q> const s(normalize(cross(f, up)));
+		vec<3, T, Q> const f(detail::eval_normalize(center - eye));
+		vec<3, T, Q> const s(detail::eval_normalize(cross(f, up)));
 		vec<3, T, Q> const u(cross(s, f));
 
 		mat<4, 4, T, Q> Result(1);
@@ -173,10 +184,10 @@ namespace glm
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> lookAtLH(vec<3, T, Q> const& eye, vec<3, T, Q> const& center, vec<3, T, Q> const& up)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX20 mat<4, 4, T, Q> lookAtLH(vec<3, T, Q> const& eye, vec<3, T, Q> const& center, vec<3, T, Q> const& up)
 	{
-		vec<3, T, Q> const f(normalize(center - eye));
-		vec<3, T, Q> const s(normalize(cross(up, f)));
+		vec<3, T, Q> const f(detail::eval_normalize(center - eye));
+		vec<3, T, Q> const s(detail::eval_normalize(cross(up, f)));
 		vec<3, T, Q> const u(cross(f, s));
 
 		mat<4, 4, T, Q> Result(1);
@@ -196,7 +207,7 @@ namespace glm
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> lookAt(vec<3, T, Q> const& eye, vec<3, T, Q> const& center, vec<3, T, Q> const& up)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX20 mat<4, 4, T, Q> lookAt(vec<3, T, Q> const& eye, vec<3, T, Q> const& center, vec<3, T, Q> const& up)
 	{
 #       if (GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_LH_BIT)
             return lookAtLH(eye, center, up);
@@ -135,3 +135,46 @@
 #include "matrix.hpp"
 #include "vector_relational.hpp"
 #include "integer.hpp"
+
+#if GLM_CONFIG_EXTERN_TEMPLATE == GLM_ENABLE && GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+// Declared once every type_vec*.inl is included: type_vec_simd.inl specializes members of the aligned types
+namespace glm
+{
+	extern template struct vec<2, float, aligned_highp>;
+	extern template struct vec<2, double, aligned_highp>;
+	extern template struct vec<3, float, aligned_highp>;
+	extern template struct vec<3, double, aligned_highp>;
+	extern template struct vec<4, float, aligned_highp>;
+	extern template struct vec<4, double, aligned_highp>;
+	extern template struct mat<3, 3, float, aligned_highp>;
+	extern template struct mat<3, 3, double, aligned_highp>;
+
+	extern template mat<3, 3, float, aligned_highp> operator*(mat<3, 3, float, aligned_highp> const&, mat<3, 3, float, aligned_highp> const&);
+	extern template vec<3, float, aligned_highp> operator*(mat<3, 3, float, aligned_highp> const&, vec<3, float, aligned_highp> const&);
+	extern template vec<3, float, aligned_highp> operator*(vec<3, float, aligned_highp> const&, mat<3, 3, float, aligned_highp> const&);
+	extern template mat<3, 3, double, aligned_highp> operator*(mat<3, 3, double, aligned_highp> const&, mat<3, 3, double, aligned_highp> const&);
+	extern template vec<3, double, aligned_highp> operator*(mat<3, 3, double, aligned_highp> const&, vec<3, double, aligned_highp> const&);
+	extern template vec<3, double, aligned_highp> operator*(vec<3, double, aligned_highp> const&, mat<3, 3, double, aligned_highp> const&);
+	extern template struct mat<4, 4, float, aligned_highp>;
+	extern template struct mat<4, 4, double, aligned_highp>;
+
+	extern template mat<4, 4, float, aligned_highp> operator*(mat<4, 4, float, aligned_highp> const&, mat<4, 4, float, aligned_highp> const&);
+	extern template vec<4, float, aligned_highp> operator*(mat<4, 4, float, aligned_highp> const&, vec<4, float, aligned_highp> const&);
+	extern template vec<4, float, aligned_highp> operator*(vec<4, float, aligned_highp> const&, mat<4, 4, float, aligned_highp> const&);
+	extern template mat<4, 4, double, aligned_highp> operator*(mat<4, 4, double, aligned_highp> const&, mat<4, 4, double, aligned_highp> const&);
+	extern template vec<4, double, aligned_highp> operator*(mat<4, 4, double, aligned_highp> const&, vec<4, double, aligned_highp> const&);
+	extern template vec<4, double, aligned_highp> operator*(vec<4, double, aligned_highp> const&, mat<4, 4, double, aligned_highp> const&);
+	extern template mat<3, 3, float, aligned_highp> transpose(mat<3, 3, float, aligned_highp> const&);
+	extern template float determinant(mat<3, 3, float, aligned_highp> const&);
+	extern template mat<3, 3, float, aligned_highp> inverse(mat<3, 3, float, aligned_highp> const&);
+	extern template mat<3, 3, double, aligned_highp> transpose(mat<3, 3, double, aligned_highp> const&);
+	extern template double determinant(mat<3, 3, double, aligned_highp> const&);
+	extern template mat<3, 3, double, aligned_highp> inverse(mat<3, 3, double, aligned_highp> const&);
+	extern template mat<4, 4, float, aligned_highp> transpose(mat<4, 4, float, aligned_highp> const&);
+	extern template float determinant(mat<4, 4, float, aligned_highp> const&);
+	extern template mat<4, 4, float, aligned_highp> inverse(mat<4, 4, float, aligned_highp> const&);
+	extern template mat<4, 4, double, aligned_highp> transpose(mat<4, 4, double, aligned_highp> const&);
+	extern template double determinant(mat<4, 4, double, aligned_highp> const&);
+	extern template mat<4, 4, double, aligned_highp> inverse(mat<4, 4, double, aligned_highp> const&);
+}//namespace glm
+#endif//GLM_CONFIG_EXTERN_TEMPLATE
@@ -305,6 +305,22 @@ namespace glm
 	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.4 Floating-Point Pack and Unpack Functions</a>
 	GLM_FUNC_DECL vec4 unpackHalf4x16(uint64 p);
 
+	/// Converts `Count` floating-point values starting at `In` to 16-bit floating-point values stored at `Out`, like packHalf1x16.
+	/// Uses the F16C or NEON conversion instructions on several values at once when they are available.
+	///
+	/// @see gtc_packing
+	/// @see uint16 packHalf1x16(float const& v)
+	/// @see void unpackHalf(uint16 const* In, float* Out, size_t Count)
+	GLM_FUNC_DISCARD_DECL void packHalf(float const* In, uint16* Out, size_t Count);
+
+	/// Converts `Count` 16-bit floating-point values starting at `In` to 32-bit floating-point values stored at `Out`, like unpackHalf1x16.
+	/// Uses the F16C or NEON conversion instructions on several values at once when they are available.
+	///
+	/// @see gtc_packing
+	/// @see float unpackHalf1x16(uint16 const& v)
+	/// @see void packHalf(float const* In, uint16* Out, size_t Count)
+	GLM_FUNC_DISCARD_DECL void unpackHalf(uint16 const* In, float* Out, size_t Count);
+
 	/// Returns an unsigned integer obtained by converting the components of a four-component signed integer vector
 	/// to the 10-10-10-2-bit signed integer representation found in the OpenGL Specification,
 	/// and then packing these four values into a 32-bit unsigned integer.
@@ -351,17 +351,33 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vec<4, uint16, Q> pack(vec<4, float, Q> const& v)
 		{
-			vec<4, int16, Q> const Unpack(detail::toFloat16(v.x), detail::toFloat16(v.y), detail::toFloat16(v.z), detail::toFloat16(v.w));
-			u16vec4 Packed;
-			memcpy(value_ptr(Packed), value_ptr(Unpack), sizeof(Packed));
+			vec<4, uint16, Q> Packed;
+#			if GLM_HAS_HALF_INTRINSICS && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(&Packed.x), _mm_cvtps_ph(_mm_loadu_ps(&v.x), _MM_FROUND_TO_NEAREST_INT));
+#			elif GLM_HAS_HALF_INTRINSICS && (GLM_ARCH & GLM_ARCH_NEON_BIT)
+				vst1_u16(&Packed.x, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(&v.x))));
+#			else
+				vec<4, int16, Q> const Unpack(detail::toFloat16(v.x), detail::toFloat16(v.y), detail::toFloat16(v.z), detail::toFloat16(v.w));
+				memcpy(value_ptr(Packed), value_ptr(Unpack), sizeof(Packed));
+#			endif
 			return Packed;
 		}
 
 		GLM_FUNC_QUALIFIER static vec<4, float, Q> unpack(vec<4, uint16, Q> const& v)
 		{
-			i16vec4 Unpack;
-			memcpy(value_ptr(Unpack), &v, sizeof(Unpack));
-			return vec<4, float, Q>(detail::toFloat32(Unpack.x), detail::toFloat32(Unpack.y), detail::toFloat32(Unpack.z), detail::toFloat32(Unpack.w));
+#			if GLM_HAS_HALF_INTRINSICS && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+				vec<4, float, Q> Result;
+				_mm_storeu_ps(&Result.x, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(&v.x))));
+				return Result;
+#			elif GLM_HAS_HALF_INTRINSICS && (GLM_ARCH & GLM_ARCH_NEON_BIT)
+				vec<4, float, Q> Result;
+				vst1q_f32(&Result.x, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(&v.x))));
+				return Result;
+#			else
+				i16vec4 Unpack;
+				memcpy(value_ptr(Unpack), &v, sizeof(Unpack));
+				return vec<4, float, Q>(detail::toFloat32(Unpack.x), detail::toFloat32(Unpack.y), detail::toFloat32(Unpack.z), detail::toFloat32(Unpack.w));
+#			endif
 		}
 	};
 }//namespace detail
@@ -504,11 +520,7 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint64 packHalf4x16(glm::vec4 const& v)
 	{
-		i16vec4 const Unpack(
-			detail::toFloat16(v.x),
-			detail::toFloat16(v.y),
-			detail::toFloat16(v.z),
-			detail::toFloat16(v.w));
+		u16vec4 const Unpack(detail::compute_half<4, defaultp>::pack(v));
 		uint64 Packed = 0;
 		memcpy(&Packed, value_ptr(Unpack), sizeof(Packed));
 		return Packed;
@@ -516,13 +528,37 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER glm::vec4 unpackHalf4x16(uint64 v)
 	{
-		i16vec4 Unpack;
+		u16vec4 Unpack;
 		memcpy(value_ptr(Unpack), &v, sizeof(Unpack));
-		return vec4(
-			detail::toFloat32(Unpack.x),
-			detail::toFloat32(Unpack.y),
-			detail::toFloat32(Unpack.z),
-			detail::toFloat32(Unpack.w));
+		return detail::compute_half<4, defaultp>::unpack(Unpack);
+	}
+
+	GLM_FUNC_QUALIFIER void packHalf(float const* In, uint16* Out, size_t Count)
+	{
+		size_t i = 0;
+#		if GLM_HAS_HALF_INTRINSICS && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+			for(; i + 8 <= Count; i += 8)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), _mm256_cvtps_ph(_mm256_loadu_ps(In + i), _MM_FROUND_TO_NEAREST_INT));
+#		elif GLM_HAS_HALF_INTRINSICS && (GLM_ARCH & GLM_ARCH_NEON_BIT)
+			for(; i + 4 <= Count; i += 4)
+				vst1_u16(Out + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(In + i))));
+#		endif
+		for(; i < Count; ++i)
+			Out[i] = packHalf1x16(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf(uint16 const* In, float* Out, size_t Count)
+	{
+		size_t i = 0;
+#		if GLM_HAS_HALF_INTRINSICS && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+			for(; i + 8 <= Count; i += 8)
+				_mm256_storeu_ps(Out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i))));
+#		elif GLM_HAS_HALF_INTRINSICS && (GLM_ARCH & GLM_ARCH_NEON_BIT)
+			for(; i + 4 <= Count; i += 4)
+				vst1q_f32(Out + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(In + i))));
+#		endif
+		for(; i < Count; ++i)
+			Out[i] = unpackHalf1x16(In[i]);
 	}
 
 	GLM_FUNC_QUALIFIER uint32 packI3x10_1x2(ivec4 const& v)
@@ -0,0 +1,94 @@
+/// @ref gtx_color_space_buffer
+/// @file glm/gtx/color_space_buffer.hpp
+///
+/// @see core (dependence)
+/// @see gtc_packing (dependence)
+///
+/// @defgroup gtx_color_space_buffer GLM_GTX_color_space_buffer
+/// @ingroup gtx
+///
+/// Include <glm/gtx/color_space_buffer.hpp> to use the features of this extension.
+///
+/// Color space conversions over whole pixel buffers: sRGB to and from linear for RGBA8, RGB16F and RGBA32F pixels,
+/// RGB to and from YCoCg, and linear sRGB to and from CIE XYZ.
+///
+/// 8-bit sRGB is decoded through a 256-entry table instead of a pow per channel.
+/// With SIMD enabled (GLM_FORCE_INTRINSICS), float sRGB curves are evaluated on whole pixels with minimax
+/// polynomials for log2 and exp2, with a relative error below 1.1e-6 against pow (up to 16 float ULPs);
+/// otherwise pow is used.
+/// Pixels are converted independently, so a buffer can be cut into row ranges and converted on several threads.
+/// The output may be the same buffer as the input when both have the same pixel type.
+/// Alpha is passed through, linearly rescaled for RGBA8.
+
+#pragma once
+
+// Dependencies
+#include "../glm.hpp"
+#include "../gtc/packing.hpp"
+#include "../gtc/type_precision.hpp"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_color_space_buffer is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_color_space_buffer extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_color_space_buffer
+	/// @{
+
+	/// Decodes `Count` RGBA8 sRGB pixels to linear floats.
+	/// @see gtx_color_space_buffer
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void convertSRGBToLinear(vec<4, uint8, Q> const* In, vec<4, float, Q>* Out, size_t Count);
+
+	/// Encodes `Count` linear float pixels to RGBA8 sRGB, clamped to [0, 1] and rounded to nearest.
+	/// @see gtx_color_space_buffer
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void convertLinearToSRGB(vec<4, float, Q> const* In, vec<4, uint8, Q>* Out, size_t Count);
+
+	/// Decodes `Count` RGBA32F sRGB pixels to linear.
+	/// @see gtx_color_space_buffer
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void convertSRGBToLinear(vec<4, float, Q> const* In, vec<4, float, Q>* Out, size_t Count);
+
+	/// Encodes `Count` linear RGBA32F pixels to sRGB, clamped to [0, 1].
+	/// @see gtx_color_space_buffer
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void convertLinearToSRGB(vec<4, float, Q> const* In, vec<4, float, Q>* Out, size_t Count);
+
+	/// Decodes `Count` RGB16F sRGB pixels to linear; each channel holds the bits of a half float.
+	/// @see gtx_color_space_buffer
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void convertSRGBToLinearHalf(vec<3, uint16, Q> const* In, vec<3, uint16, Q>* Out, size_t Count);
+
+	/// Encodes `Count` linear RGB16F pixels to sRGB; each channel holds the bits of a half float.
+	/// @see gtx_color_space_buffer
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void convertLinearToSRGBHalf(vec<3, uint16, Q> const* In, vec<3, uint16, Q>* Out, size_t Count);
+
+	/// Converts `Count` RGBA32F pixels from RGB to YCoCg, like rgb2YCoCg.
+	/// @see gtx_color_space_buffer
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void rgb2YCoCg(vec<4, float, Q> const* In, vec<4, float, Q>* Out, size_t Count);
+
+	/// Converts `Count` RGBA32F pixels from YCoCg to RGB, like YCoCg2rgb.
+	/// @see gtx_color_space_buffer
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void YCoCg2rgb(vec<4, float, Q> const* In, vec<4, float, Q>* Out, size_t Count);
+
+	/// Converts `Count` linear sRGB RGBA32F pixels to CIE XYZ with the IEC 61966-2-1 matrix (D65 white point).
+	/// @see gtx_color_space_buffer
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void convertLinearSRGBToXYZ(vec<4, float, Q> const* In, vec<4, float, Q>* Out, size_t Count);
+
+	/// Converts `Count` CIE XYZ (D65 white point) RGBA32F pixels to linear sRGB.
+	/// @see gtx_color_space_buffer
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void convertXYZToLinearSRGB(vec<4, float, Q> const* In, vec<4, float, Q>* Out, size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "color_space_buffer.inl"
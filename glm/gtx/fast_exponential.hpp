@@ -33,6 +33,8 @@ namespace glm
 	GLM_FUNC_DECL genType fastPow(genType x, genType y);
 
 	/// Faster than the common pow function but less accurate.
+	/// With SIMD enabled, aligned vec4 of float are evaluated in one pass for positive x with a relative error
+	/// below 4e-7 + 1e-7 * |y * log2(x)|, as long as y * log2(x) stays in [-126, 127].
 	/// @see gtx_fast_exponential
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_DECL vec<L, T, Q> fastPow(vec<L, T, Q> const& x, vec<L, T, Q> const& y);
@@ -53,6 +55,7 @@ namespace glm
 	GLM_FUNC_DECL T fastExp(T x);
 
 	/// Faster than the common exp function but less accurate.
+	/// With SIMD enabled, aligned vec4 of float are evaluated in one pass with a relative error below 5e-6 for x in [-87, 87].
 	/// @see gtx_fast_exponential
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_DECL vec<L, T, Q> fastExp(vec<L, T, Q> const& x);
@@ -62,7 +65,8 @@ namespace glm
 	template<typename T>
 	GLM_FUNC_DECL T fastLog(T x);
 
-	/// Faster than the common exp2 function but less accurate.
+	/// Faster than the common log function but less accurate.
+	/// With SIMD enabled, aligned vec4 of float are evaluated in one pass with an absolute error below 1e-5 for positive normal x.
 	/// @see gtx_fast_exponential
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_DECL vec<L, T, Q> fastLog(vec<L, T, Q> const& x);
@@ -73,6 +77,7 @@ namespace glm
 	GLM_FUNC_DECL T fastExp2(T x);
 
 	/// Faster than the common exp2 function but less accurate.
+	/// With SIMD enabled, aligned vec4 of float are evaluated in one pass with a relative error below 4e-7 for x in [-126, 127].
 	/// @see gtx_fast_exponential
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_DECL vec<L, T, Q> fastExp2(vec<L, T, Q> const& x);
@@ -83,6 +88,7 @@ namespace glm
 	GLM_FUNC_DECL T fastLog2(T x);
 
 	/// Faster than the common log2 function but less accurate.
+	/// With SIMD enabled, aligned vec4 of float are evaluated in one pass with an error below 4e-7 * max(1, |log2(x)|) for positive normal x.
 	/// @see gtx_fast_exponential
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_DECL vec<L, T, Q> fastLog2(vec<L, T, Q> const& x);
@@ -1,7 +1,111 @@
 /// @ref gtx_fast_exponential
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_fastPow
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+		{
+			return exp(y * log(x));
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_fastExp
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(fastExp, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_fastLog
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(fastLog, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_fastExp2
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(fastExp2, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_fastLog2
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(fastLog2, x);
+		}
+	};
+
+#	if GLM_CONFIG_SIMD == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+	template<qualifier Q>
+	struct compute_fastPow<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& x, vec<4, float, Q> const& y)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_exp2_lowp(_mm_mul_ps(y.data, glm_vec4_log2_lowp(x.data)));
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_fastExp<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& x)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_exp2_lowp(_mm_mul_ps(x.data, _mm_set1_ps(1.44269504088896341f)));
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_fastLog<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& x)
+		{
+			vec<4, float, Q> Result;
+			Result.data = _mm_mul_ps(glm_vec4_log2_lowp(x.data), _mm_set1_ps(0.693147180559945309f));
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_fastExp2<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& x)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_exp2_lowp(x.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_fastLog2<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& x)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_log2_lowp(x.data);
+			return Result;
+		}
+	};
+#	endif
+}//namespace detail
+
 	// fastPow:
 	template<typename genType>
 	GLM_FUNC_QUALIFIER genType fastPow(genType x, genType y)
@@ -12,7 +116,7 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastPow(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
 	{
-		return exp(y * log(x));
+		return detail::compute_fastPow<L, T, Q, detail::is_aligned<Q>::value>::call(x, y);
 	}
 
 	template<typename T>
@@ -83,7 +187,7 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastExp(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(fastExp, x);
+		return detail::compute_fastExp<L, T, Q, detail::is_aligned<Q>::value>::call(x);
 	}
 
 	// fastLog
@@ -105,7 +209,7 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastLog(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(fastLog, x);
+		return detail::compute_fastLog<L, T, Q, detail::is_aligned<Q>::value>::call(x);
 	}
 
 	//fastExp2, ln2 = 0.69314718055994530941723212145818f
@@ -118,7 +222,7 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastExp2(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(fastExp2, x);
+		return detail::compute_fastExp2<L, T, Q, detail::is_aligned<Q>::value>::call(x);
 	}
 
 	// fastLog2, ln2 = 0.69314718055994530941723212145818f
@@ -131,6 +235,6 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastLog2(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(fastLog2, x);
+		return detail::compute_fastLog2<L, T, Q, detail::is_aligned<Q>::value>::call(x);
 	}
 }//namespace glm
@@ -25,6 +25,54 @@ namespace detail
 	{
 		return detail::functor1<vec, L, T, T, Q>::call(cos_52s, x);
 	}
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_fastCos
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(fastCos, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_fastSin
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(fastSin, x);
+		}
+	};
+
+#	if GLM_CONFIG_SIMD == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+	template<qualifier Q>
+	struct compute_fastCos<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& x)
+		{
+			if(!compute_trigonometric_in_range(x.data))
+				return detail::functor1<vec, 4, float, float, Q>::call(fastCos, x);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_cos_lowp(x.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_fastSin<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& x)
+		{
+			if(!compute_trigonometric_in_range(x.data))
+				return detail::functor1<vec, 4, float, float, Q>::call(fastSin, x);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_sin_lowp(x.data);
+			return Result;
+		}
+	};
+#	endif
 }//namespace detail
 
 	// wrapAngle
@@ -59,7 +107,7 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastCos(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(fastCos, x);
+		return detail::compute_fastCos<L, T, Q, detail::is_aligned<Q>::value>::call(x);
 	}
 
 	// sin
@@ -72,7 +120,7 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastSin(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(fastSin, x);
+		return detail::compute_fastSin<L, T, Q, detail::is_aligned<Q>::value>::call(x);
 	}
 
 	// tan
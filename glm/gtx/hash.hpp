@@ -9,6 +9,9 @@
 /// Include <glm/gtx/hash.hpp> to use the features of this extension.
 ///
 /// Add std::hash support for glm types
+///
+/// The components are hashed together with wyhash, two 32-bit components per 64-bit word.
+/// Floating-point components are hashed by value: 0 and -0 hash equally, so do all NaNs.
 
 #pragma once
 
@@ -57,6 +60,8 @@
 #if GLM_LANG & GLM_LANG_CXX11
 #define GLM_GTX_hash 1
 #include <functional>
+#include <limits>
+#include <cstring>
 
 namespace std
 {
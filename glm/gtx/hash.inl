@@ -8,6 +8,122 @@ namespace detail
 		hash += 0x9e3779b9 + (seed << 6) + (seed >> 2);
 		seed ^= hash;
 	}
+
+	// 64x64 bit product folded to 64 bits, the mixing step of wyhash
+	GLM_FUNC_QUALIFIER uint64 hash_mum(uint64 a, uint64 b)
+	{
+#		if defined(__SIZEOF_INT128__)
+			__extension__ typedef unsigned __int128 uint128;
+			uint128 const Product = static_cast<uint128>(a) * b;
+			return static_cast<uint64>(Product) ^ static_cast<uint64>(Product >> 64);
+#		else
+			uint64 const LowA = a & 0xffffffffull, HighA = a >> 32;
+			uint64 const LowB = b & 0xffffffffull, HighB = b >> 32;
+			uint64 const LL = LowA * LowB, LH = LowA * HighB, HL = HighA * LowB, HH = HighA * HighB;
+			uint64 const Mid = (LL >> 32) + (LH & 0xffffffffull) + (HL & 0xffffffffull);
+			uint64 const Low = (Mid << 32) | (LL & 0xffffffffull);
+			uint64 const High = HH + (LH >> 32) + (HL >> 32) + (Mid >> 32);
+			return Low ^ High;
+#		endif
+	}
+
+	// Bits of a component as they are hashed. 0 and -0 share the bits of 0 and every NaN shares the bits
+	// of quiet_NaN, so that values comparing equal hash equally. Other types fall back to their std::hash.
+	template<typename T, bool isFloat = std::numeric_limits<T>::is_iec559, bool isInteger = std::numeric_limits<T>::is_integer>
+	struct compute_hash_bits
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(T const& v)
+		{
+			return static_cast<uint64>(std::hash<T>()(v));
+		}
+	};
+
+	template<typename T>
+	struct compute_hash_bits<T, false, true>
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(T v)
+		{
+			return sizeof(T) < sizeof(uint64) ? static_cast<uint64>(v) & ((1ull << (sizeof(T) * 8)) - 1) : static_cast<uint64>(v);
+		}
+	};
+
+	template<typename T, std::size_t Size = sizeof(T)>
+	struct compute_hash_float_bits
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(T v)
+		{
+			return static_cast<uint64>(std::hash<T>()(v));
+		}
+	};
+
+	template<typename T>
+	struct compute_hash_float_bits<T, 4>
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(T v)
+		{
+			glm::uint Bits;
+			std::memcpy(&Bits, &v, sizeof(Bits));
+			return Bits;
+		}
+	};
+
+	template<typename T>
+	struct compute_hash_float_bits<T, 8>
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(T v)
+		{
+			uint64 Bits;
+			std::memcpy(&Bits, &v, sizeof(Bits));
+			return Bits;
+		}
+	};
+
+	template<typename T>
+	struct compute_hash_bits<T, true, false>
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(T v)
+		{
+			if(v == static_cast<T>(0))
+				return 0;
+			if(v != v)
+				return compute_hash_float_bits<T>::call(std::numeric_limits<T>::quiet_NaN());
+			return compute_hash_float_bits<T>::call(v);
+		}
+	};
+
+	// wyhash over the component bits, 128 bits per step. Components of up to 32 bits are packed by two
+	// in each 64-bit word, so an ivec3 or a vec3 is hashed with two multiplications.
+	template<typename T>
+	GLM_FUNC_QUALIFIER size_t hash_components(T const* Data, length_t Count, uint64 Seed)
+	{
+		uint64 const Secret0 = 0xa0761d6478bd642full;
+		uint64 const Secret1 = 0xe7037ed1a0b428dbull;
+		length_t const PerWord = sizeof(T) <= 4 ? 2 : 1;
+
+		Seed ^= Secret0;
+		for(length_t i = 0; i < Count;)
+		{
+			uint64 Words[2] = {0, 0};
+			for(length_t w = 0; w < 2; ++w)
+			for(length_t c = 0; c < PerWord && i < Count; ++c, ++i)
+				Words[w] |= compute_hash_bits<T>::call(Data[i]) << (32 * c);
+			Seed = hash_mum(Words[0] ^ Secret1, Words[1] ^ Seed);
+		}
+		return static_cast<size_t>(hash_mum(Seed ^ Secret1, static_cast<uint64>(Count) ^ Secret0));
+	}
+
+	// columns are hashed in one pass unless they are padded, like the columns of an aligned mat3
+	template<length_t C, length_t R, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER size_t hash_matrix(mat<C, R, T, Q> const& m)
+	{
+		if(sizeof(typename mat<C, R, T, Q>::col_type) == sizeof(T) * R)
+			return hash_components(&m[0][0], C * R, 0);
+
+		size_t Seed = 0;
+		for(length_t i = 0; i < C; ++i)
+			Seed = hash_components(&m[i][0], R, Seed);
+		return Seed;
+	}
 }}
 
 namespace std
@@ -15,161 +131,90 @@ namespace std
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::vec<1, T, Q> >::operator()(glm::vec<1, T, Q> const& v) const GLM_NOEXCEPT
 	{
-		hash<T> hasher;
-		return hasher(v.x);
+		return glm::detail::hash_components(&v[0], 1, 0);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::vec<2, T, Q> >::operator()(glm::vec<2, T, Q> const& v) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(v.x));
-		glm::detail::hash_combine(seed, hasher(v.y));
-		return seed;
+		return glm::detail::hash_components(&v[0], 2, 0);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::vec<3, T, Q> >::operator()(glm::vec<3, T, Q> const& v) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(v.x));
-		glm::detail::hash_combine(seed, hasher(v.y));
-		glm::detail::hash_combine(seed, hasher(v.z));
-		return seed;
+		return glm::detail::hash_components(&v[0], 3, 0);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::vec<4, T, Q> >::operator()(glm::vec<4, T, Q> const& v) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(v.x));
-		glm::detail::hash_combine(seed, hasher(v.y));
-		glm::detail::hash_combine(seed, hasher(v.z));
-		glm::detail::hash_combine(seed, hasher(v.w));
-		return seed;
+		return glm::detail::hash_components(&v[0], 4, 0);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::qua<T, Q> >::operator()(glm::qua<T,Q> const& q) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(q.x));
-		glm::detail::hash_combine(seed, hasher(q.y));
-		glm::detail::hash_combine(seed, hasher(q.z));
-		glm::detail::hash_combine(seed, hasher(q.w));
-		return seed;
+		return glm::detail::hash_components(&q[0], 4, 0);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tdualquat<T, Q> >::operator()(glm::tdualquat<T, Q> const& q) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<glm::qua<T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(q.real));
-		glm::detail::hash_combine(seed, hasher(q.dual));
-		return seed;
+		return glm::detail::hash_components(&q.dual[0], 4, glm::detail::hash_components(&q.real[0], 4, 0));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<2, 2, T, Q> >::operator()(glm::mat<2, 2, T, Q> const& m) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<glm::vec<2, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		return seed;
+		return glm::detail::hash_matrix(m);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<2, 3, T, Q> >::operator()(glm::mat<2, 3, T, Q> const& m) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<glm::vec<3, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		return seed;
+		return glm::detail::hash_matrix(m);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<2, 4, T, Q> >::operator()(glm::mat<2, 4, T, Q> const& m) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<glm::vec<4, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		return seed;
+		return glm::detail::hash_matrix(m);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<3, 2, T, Q> >::operator()(glm::mat<3, 2, T, Q> const& m) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<glm::vec<2, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		return seed;
+		return glm::detail::hash_matrix(m);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<3, 3, T, Q> >::operator()(glm::mat<3, 3, T, Q> const& m) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<glm::vec<3, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		return seed;
+		return glm::detail::hash_matrix(m);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<3, 4, T, Q> >::operator()(glm::mat<3, 4, T, Q> const& m) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<glm::vec<4, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		return seed;
+		return glm::detail::hash_matrix(m);
 	}
 
 	template<typename T, glm::qualifier Q>
-	GLM_FUNC_QUALIFIER size_t hash<glm::mat<4, 2, T,Q> >::operator()(glm::mat<4, 2, T,Q> const& m) const GLM_NOEXCEPT
+	GLM_FUNC_QUALIFIER size_t hash<glm::mat<4, 2, T, Q> >::operator()(glm::mat<4, 2, T, Q> const& m) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<glm::vec<2, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		glm::detail::hash_combine(seed, hasher(m[3]));
-		return seed;
+		return glm::detail::hash_matrix(m);
 	}
 
 	template<typename T, glm::qualifier Q>
-	GLM_FUNC_QUALIFIER size_t hash<glm::mat<4, 3, T,Q> >::operator()(glm::mat<4, 3, T,Q> const& m) const GLM_NOEXCEPT
+	GLM_FUNC_QUALIFIER size_t hash<glm::mat<4, 3, T, Q> >::operator()(glm::mat<4, 3, T, Q> const& m) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<glm::vec<3, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		glm::detail::hash_combine(seed, hasher(m[3]));
-		return seed;
+		return glm::detail::hash_matrix(m);
 	}
 
 	template<typename T, glm::qualifier Q>
-	GLM_FUNC_QUALIFIER size_t hash<glm::mat<4, 4, T,Q> >::operator()(glm::mat<4, 4, T, Q> const& m) const GLM_NOEXCEPT
-	{
-		size_t seed = 0;
-		hash<glm::vec<4, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		glm::detail::hash_combine(seed, hasher(m[3]));
-		return seed;
+	GLM_FUNC_QUALIFIER size_t hash<glm::mat<4, 4, T, Q> >::operator()(glm::mat<4, 4, T, Q> const& m) const GLM_NOEXCEPT
+	{
+		return glm::detail::hash_matrix(m);
 	}
 }
@@ -0,0 +1,86 @@
+/// @ref gtx_matrix_affine
+/// @file glm/gtx/matrix_affine.hpp
+///
+/// @see core (dependence)
+/// @see gtx_matrix_decompose
+///
+/// @defgroup gtx_matrix_affine GLM_GTX_matrix_affine
+/// @ingroup gtx
+///
+/// Include <glm/gtx/matrix_affine.hpp> to use the features of this extension.
+///
+/// Affine transforms packed in a mat3x4: each column holds one of the first three rows of the
+/// equivalent 4x4 matrix, the last row (0, 0, 0, 1) is implied. This is the layout written by
+/// recomposeTRS. It's 48 bytes instead of 64 and a shader applies it as `vec4(p, 1) * m`, with
+/// `m` a `mat3x4` uploaded by `glUniformMatrix3x4fv(location, 1, GL_FALSE, value_ptr(m))` or
+/// read as three vec4 instance attributes.
+
+#pragma once
+
+// Dependencies
+#include "../mat3x3.hpp"
+#include "../mat3x4.hpp"
+#include "../mat4x4.hpp"
+#include "../vec3.hpp"
+#include "../vec4.hpp"
+#include "../geometric.hpp"
+#include "../matrix.hpp"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_matrix_affine is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_matrix_affine extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_matrix_affine
+	/// @{
+
+	/// Packs the first three rows of an affine 4x4 matrix. The last row of m is ignored.
+	/// @see gtx_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<3, 4, T, Q> affineFromMat4(mat<4, 4, T, Q> const& m);
+
+	/// Expands a packed affine transform to a 4x4 matrix.
+	/// @see gtx_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, Q> affineToMat4(mat<3, 4, T, Q> const& a);
+
+	/// Returns the packed form of affineToMat4(a) * affineToMat4(b): b is applied first.
+	/// The implied last rows are not multiplied, it's 63 flops instead of 112 for a 4x4 product.
+	/// When SIMD is enabled, float matrices take an SSE2 path whether they are aligned or packed.
+	/// @see gtx_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<3, 4, T, Q> affineCompose(mat<3, 4, T, Q> const& a, mat<3, 4, T, Q> const& b);
+
+	/// Inverse of a packed affine transform with an invertible 3x3 part.
+	/// @see gtx_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 4, T, Q> affineInverse(mat<3, 4, T, Q> const& a);
+
+	/// Inverse of a packed affine transform whose 3x3 part is a rotation, without scale or shear.
+	/// The rotation is transposed and the translation rotated back, no division is involved.
+	/// @see gtx_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<3, 4, T, Q> affineInverseRigid(mat<3, 4, T, Q> const& a);
+
+	/// Transforms a point, translation included.
+	/// @see gtx_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR vec<3, T, Q> affineTransformPoint(mat<3, 4, T, Q> const& a, vec<3, T, Q> const& p);
+
+	/// Transforms a direction, translation excluded.
+	/// @see gtx_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR vec<3, T, Q> affineTransformVector(mat<3, 4, T, Q> const& a, vec<3, T, Q> const& v);
+
+	/// Returns the translation of a packed affine transform.
+	/// @see gtx_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR vec<3, T, Q> affineTranslation(mat<3, 4, T, Q> const& a);
+
+	/// @}
+}//namespace glm
+
+#include "matrix_affine.inl"
@@ -0,0 +1,133 @@
+/// @ref gtx_matrix_affine
+
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q>
+	struct compute_affineCompose
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<3, 4, T, Q> call(mat<3, 4, T, Q> const& a, mat<3, 4, T, Q> const& b)
+		{
+			// Each row of the result combines the rows of b, accumulated in the same order as
+			// the 4x4 product. The implied last row of b is (0, 0, 0, 1), so it only adds a's
+			// translation to w.
+			vec<4, T, Q> Row0 = b[0] * a[0].x;
+			Row0 += b[1] * a[0].y;
+			Row0 += b[2] * a[0].z;
+			Row0.w += a[0].w;
+			vec<4, T, Q> Row1 = b[0] * a[1].x;
+			Row1 += b[1] * a[1].y;
+			Row1 += b[2] * a[1].z;
+			Row1.w += a[1].w;
+			vec<4, T, Q> Row2 = b[0] * a[2].x;
+			Row2 += b[1] * a[2].y;
+			Row2 += b[2] * a[2].z;
+			Row2.w += a[2].w;
+			return mat<3, 4, T, Q>(Row0, Row1, Row2);
+		}
+	};
+
+#	if GLM_CONFIG_SIMD == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+	// Rows are loaded unaligned so that packed matrices, the usual storage of a scene graph, take this path too.
+	// Left to itself the compiler vectorizes the generic code across rows and ends up slower than a 4x4 product.
+	template<qualifier Q>
+	struct compute_affineCompose<float, Q>
+	{
+		GLM_FUNC_QUALIFIER static glm_f32vec4 row(glm_f32vec4 a, glm_f32vec4 b0, glm_f32vec4 b1, glm_f32vec4 b2)
+		{
+			glm_f32vec4 const Translation = _mm_and_ps(a, _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0)));
+			glm_f32vec4 Result = _mm_mul_ps(b0, _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0)));
+			Result = glm_vec4_fma(b1, _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)), Result);
+			Result = glm_vec4_fma(b2, _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2)), Result);
+			return glm_vec4_add(Result, Translation);
+		}
+
+		GLM_FUNC_QUALIFIER static mat<3, 4, float, Q> call(mat<3, 4, float, Q> const& a, mat<3, 4, float, Q> const& b)
+		{
+			glm_f32vec4 const b0 = _mm_loadu_ps(&b[0].x);
+			glm_f32vec4 const b1 = _mm_loadu_ps(&b[1].x);
+			glm_f32vec4 const b2 = _mm_loadu_ps(&b[2].x);
+
+			mat<3, 4, float, Q> Result;
+			_mm_storeu_ps(&Result[0].x, row(_mm_loadu_ps(&a[0].x), b0, b1, b2));
+			_mm_storeu_ps(&Result[1].x, row(_mm_loadu_ps(&a[1].x), b0, b1, b2));
+			_mm_storeu_ps(&Result[2].x, row(_mm_loadu_ps(&a[2].x), b0, b1, b2));
+			return Result;
+		}
+	};
+#	endif
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR mat<3, 4, T, Q> affineFromMat4(mat<4, 4, T, Q> const& m)
+	{
+		return mat<3, 4, T, Q>(
+			vec<4, T, Q>(m[0][0], m[1][0], m[2][0], m[3][0]),
+			vec<4, T, Q>(m[0][1], m[1][1], m[2][1], m[3][1]),
+			vec<4, T, Q>(m[0][2], m[1][2], m[2][2], m[3][2]));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR mat<4, 4, T, Q> affineToMat4(mat<3, 4, T, Q> const& a)
+	{
+		return mat<4, 4, T, Q>(
+			vec<4, T, Q>(a[0][0], a[1][0], a[2][0], static_cast<T>(0)),
+			vec<4, T, Q>(a[0][1], a[1][1], a[2][1], static_cast<T>(0)),
+			vec<4, T, Q>(a[0][2], a[1][2], a[2][2], static_cast<T>(0)),
+			vec<4, T, Q>(a[0][3], a[1][3], a[2][3], static_cast<T>(1)));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR mat<3, 4, T, Q> affineCompose(mat<3, 4, T, Q> const& a, mat<3, 4, T, Q> const& b)
+	{
+		return detail::compute_affineCompose<T, Q>::call(a, b);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> affineInverse(mat<3, 4, T, Q> const& a)
+	{
+		// The columns of this mat3 are the rows of the 3x3 part, so the columns of
+		// its inverse are the rows of the inverse 3x3 part.
+		mat<3, 3, T, Q> const Inv(inverse(mat<3, 3, T, Q>(vec<3, T, Q>(a[0]), vec<3, T, Q>(a[1]), vec<3, T, Q>(a[2]))));
+		vec<3, T, Q> const t(a[0].w, a[1].w, a[2].w);
+
+		return mat<3, 4, T, Q>(
+			vec<4, T, Q>(Inv[0], -dot(Inv[0], t)),
+			vec<4, T, Q>(Inv[1], -dot(Inv[1], t)),
+			vec<4, T, Q>(Inv[2], -dot(Inv[2], t)));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR mat<3, 4, T, Q> affineInverseRigid(mat<3, 4, T, Q> const& a)
+	{
+		// rows of the transposed rotation, then the translation rotated back
+		vec<3, T, Q> const r0(a[0][0], a[1][0], a[2][0]);
+		vec<3, T, Q> const r1(a[0][1], a[1][1], a[2][1]);
+		vec<3, T, Q> const r2(a[0][2], a[1][2], a[2][2]);
+		vec<3, T, Q> const t(a[0].w, a[1].w, a[2].w);
+
+		return mat<3, 4, T, Q>(
+			vec<4, T, Q>(r0, -dot(r0, t)),
+			vec<4, T, Q>(r1, -dot(r1, t)),
+			vec<4, T, Q>(r2, -dot(r2, t)));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<3, T, Q> affineTransformPoint(mat<3, 4, T, Q> const& a, vec<3, T, Q> const& p)
+	{
+		vec<4, T, Q> const v(p, static_cast<T>(1));
+		return vec<3, T, Q>(dot(a[0], v), dot(a[1], v), dot(a[2], v));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<3, T, Q> affineTransformVector(mat<3, 4, T, Q> const& a, vec<3, T, Q> const& v)
+	{
+		return vec<3, T, Q>(dot(vec<3, T, Q>(a[0]), v), dot(vec<3, T, Q>(a[1]), v), dot(vec<3, T, Q>(a[2]), v));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<3, T, Q> affineTranslation(mat<3, 4, T, Q> const& a)
+	{
+		return vec<3, T, Q>(a[0].w, a[1].w, a[2].w);
+	}
+}//namespace glm
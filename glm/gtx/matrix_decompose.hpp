@@ -13,6 +13,7 @@
 #pragma once
 
 // Dependencies
+#include "../mat3x4.hpp"
 #include "../mat4x4.hpp"
 #include "../vec3.hpp"
 #include "../vec4.hpp"
@@ -44,6 +45,25 @@ namespace glm
 		vec<3, T, Q> const& scale, qua<T, Q> const& orientation, vec<3, T, Q> const& translation,
 		vec<3, T, Q> const& skew, vec<4, T, Q> const& perspective);
 
+	/// Decomposes `count` affine matrices built from translation, rotation and scale only (no skew, no perspective).
+	/// Much cheaper than decompose: the scales are the lengths of the first three columns and the rotation is read from the normalized columns.
+	/// A mirroring matrix comes out with all three scales negated, like with decompose. Matrices with a zero scale give undefined results.
+	/// Any of the output arrays may be null if it is not needed.
+	/// @see gtx_matrix_decompose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void decomposeTRS(
+		mat<4, 4, T, Q> const* matrices, size_t count,
+		vec<3, T, Q>* scales, qua<T, Q>* orientations, vec<3, T, Q>* translations);
+
+	/// Recomposes `count` affine matrices from translation, rotation and scale, as packed 3x4 matrices ready for GPU upload.
+	/// Each output holds the first three rows of the 4x4 matrix, one per column, so a shader applies it as `vec4(p, 1) * m` with `m` a `mat3x4`.
+	/// The orientations do not have to be normalized, so blended quaternions can be passed directly.
+	/// @see gtx_matrix_decompose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void recomposeTRS(
+		vec<3, T, Q> const* scales, qua<T, Q> const* orientations, vec<3, T, Q> const* translations, size_t count,
+		mat<3, 4, T, Q>* affines);
+
 	/// @}
 }//namespace glm
 
@@ -231,4 +231,60 @@ namespace detail
 
 		return m;
 	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void decomposeTRS(
+		mat<4, 4, T, Q> const* matrices, size_t count,
+		vec<3, T, Q>* scales, qua<T, Q>* orientations, vec<3, T, Q>* translations)
+	{
+		for(size_t n = 0; n < count; ++n)
+		{
+			mat<4, 4, T, Q> const& m = matrices[n];
+
+			// The columns are used as vec4, their w is zero in an affine matrix,
+			// so lengths and normalization run on whole (SIMD) columns.
+			vec<3, T, Q> const Length = sqrt(vec<3, T, Q>(dot(m[0], m[0]), dot(m[1], m[1]), dot(m[2], m[2])));
+
+			// a negative determinant is a mirror, folded into the scales
+			T const Sign = dot(cross(vec<3, T, Q>(m[0]), vec<3, T, Q>(m[1])), vec<3, T, Q>(m[2])) < static_cast<T>(0) ? static_cast<T>(-1) : static_cast<T>(1);
+			vec<3, T, Q> const Scale = Length * Sign;
+
+			if(scales)
+				scales[n] = Scale;
+			if(orientations)
+			{
+				vec<3, T, Q> const InvScale = static_cast<T>(1) / Scale;
+				orientations[n] = quat_cast(mat<3, 3, T, Q>(
+					vec<3, T, Q>(m[0] * InvScale.x),
+					vec<3, T, Q>(m[1] * InvScale.y),
+					vec<3, T, Q>(m[2] * InvScale.z)));
+			}
+			if(translations)
+				translations[n] = vec<3, T, Q>(m[3]);
+		}
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void recomposeTRS(
+		vec<3, T, Q> const* scales, qua<T, Q> const* orientations, vec<3, T, Q> const* translations, size_t count,
+		mat<3, 4, T, Q>* affines)
+	{
+		for(size_t n = 0; n < count; ++n)
+		{
+			qua<T, Q> const& q = orientations[n];
+			vec<3, T, Q> const& s = scales[n];
+			vec<3, T, Q> const& t = translations[n];
+
+			// rotation of a quaternion of any length: 2 / |q|^2 in place of 2
+			T const s2 = static_cast<T>(2) / (q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+			T const xx = q.x * q.x * s2, yy = q.y * q.y * s2, zz = q.z * q.z * s2;
+			T const xy = q.x * q.y * s2, xz = q.x * q.z * s2, yz = q.y * q.z * s2;
+			T const wx = q.w * q.x * s2, wy = q.w * q.y * s2, wz = q.w * q.z * s2;
+
+			// one row of the affine matrix per column: rotation times scale, then translation
+			affines[n][0] = vec<4, T, Q>((static_cast<T>(1) - yy - zz) * s.x, (xy - wz) * s.y, (xz + wy) * s.z, t.x);
+			affines[n][1] = vec<4, T, Q>((xy + wz) * s.x, (static_cast<T>(1) - xx - zz) * s.y, (yz - wx) * s.z, t.y);
+			affines[n][2] = vec<4, T, Q>((xz - wy) * s.x, (yz + wx) * s.y, (static_cast<T>(1) - xx - yy) * s.z, t.z);
+		}
+	}
 }//namespace glm
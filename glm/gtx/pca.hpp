@@ -35,6 +35,16 @@
 /// 
 /// // ... now evecs[0] points in the direction (symmetric) of the largest spatial distribution within ptData
 /// ```
+///
+/// Large point clouds do not need the center up front: a `covarianceAccumulator` collects points in one pass,
+/// and accumulators filled from separate chunks (e.g. on separate threads) can be merged.
+/// ```
+/// glm::covarianceAccumulator<3, double> acc[2];
+/// acc[0].add(ptData.data(), half);
+/// acc[1].add(ptData.data() + half, ptData.size() - half);
+/// acc[0].merge(acc[1]);
+/// glm::dmat3 covarMat = acc[0].covariance(); // acc[0].mean is the center
+/// ```
 
 #pragma once
 
@@ -75,9 +85,39 @@ namespace glm {
 	template<length_t D, typename T, qualifier Q, typename I>
 	GLM_FUNC_DECL mat<D, D, T, Q> computeCovarianceMatrix(I const& b, I const& e, vec<D, T, Q> const& c);
 
+	/// Streaming mean and covariance of a set of points, computed in a single pass.
+	/// Single points use Welford's update and arrays are added in small blocks centered on their own mean,
+	/// so the result stays accurate for points far from the origin.
+	/// Accumulators over disjoint sets of points can be merged, in any order.
+	template<length_t D, typename T, qualifier Q = defaultp>
+	struct covarianceAccumulator
+	{
+		/// Number of points added
+		size_t count;
+		/// Mean of the points added
+		vec<D, T, Q> mean;
+		/// Sum of the outer products of the points' offsets from `mean`
+		mat<D, D, T, Q> m2;
+
+		GLM_FUNC_DECL covarianceAccumulator();
+
+		/// Adds the point `v`
+		GLM_FUNC_DISCARD_DECL void add(vec<D, T, Q> const& v);
+
+		/// Adds `n` points starting at `v`
+		GLM_FUNC_DISCARD_DECL void add(vec<D, T, Q> const* v, size_t n);
+
+		/// Adds the points collected by `other`
+		GLM_FUNC_DISCARD_DECL void merge(covarianceAccumulator<D, T, Q> const& other);
+
+		/// Covariance matrix of the points added, divided by their count like computeCovarianceMatrix
+		GLM_FUNC_DECL mat<D, D, T, Q> covariance() const;
+	};
+
 	/// Assuming the provided covariance matrix `covarMat` is symmetric and real-valued, this function find the `D` Eigenvalues of the matrix, and also provides the corresponding Eigenvectors.
 	/// Note: the data in `outEigenvalues` and `outEigenvectors` are in matching order, i.e. `outEigenvector[i]` is the Eigenvector of the Eigenvalue `outEigenvalue[i]`.
 	/// This is a numeric implementation to find the Eigenvalues, using 'QL decomposition` (variant of QR decomposition: https://en.wikipedia.org/wiki/QR_decomposition).
+	/// 3x3 matrices use cyclic Jacobi rotations instead (https://en.wikipedia.org/wiki/Jacobi_eigenvalue_algorithm), which is faster and more accurate at that size.
 	///
 	/// @param[in] covarMat A symmetric, real-valued covariance matrix, e.g. computed from computeCovarianceMatrix
 	/// @param[out] outEigenvalues Vector to receive the found eigenvalues
@@ -31,9 +31,9 @@ namespace glm {
 		for(I i = b; i != e; i++)
 		{
 			vec<D, T, Q> const& v = *i;
+			// one column at a time, so the inner loop is a vector multiply-add
 			for(length_t x = 0; x < D; ++x)
-				for(length_t y = 0; y < D; ++y)
-					m[x][y] += static_cast<T>(v[x] * v[y]);
+				m[x] += v * v[x];
 			cnt++;
 		}
 		if(cnt > 0)
@@ -54,8 +54,7 @@ namespace glm {
 		{
 			v = *i - c;
 			for(length_t x = 0; x < D; ++x)
-				for(length_t y = 0; y < D; ++y)
-					m[x][y] += static_cast<T>(v[x] * v[y]);
+				m[x] += v * v[x];
 			cnt++;
 		}
 		if(cnt > 0)
@@ -64,6 +63,87 @@ namespace glm {
 		return m;
 	}
 
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER covarianceAccumulator<D, T, Q>::covarianceAccumulator()
+		: count(0)
+		, mean(static_cast<T>(0))
+		, m2(static_cast<T>(0))
+	{}
+
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void covarianceAccumulator<D, T, Q>::add(vec<D, T, Q> const& v)
+	{
+		// Welford: the sums are kept relative to the running mean
+		++count;
+		vec<D, T, Q> const delta = v - mean;
+		mean += delta / static_cast<T>(count);
+		vec<D, T, Q> const delta2 = v - mean;
+		for(length_t x = 0; x < D; ++x)
+			m2[x] += delta2 * delta[x];
+	}
+
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void covarianceAccumulator<D, T, Q>::add(vec<D, T, Q> const* v, size_t n)
+	{
+		// Small blocks are centered on their own mean, which stays in cache for the
+		// second pass, and then merged; the inner loops have no division and no
+		// dependency between points.
+		static const size_t blockSize = 256;
+
+		for(size_t first = 0; first < n; first += blockSize)
+		{
+			size_t const last = n - first < blockSize ? n : first + blockSize;
+
+			covarianceAccumulator<D, T, Q> block;
+			block.count = last - first;
+
+			vec<D, T, Q> sum(static_cast<T>(0));
+			for(size_t i = first; i < last; ++i)
+				sum += v[i];
+			block.mean = sum / static_cast<T>(block.count);
+
+			for(size_t i = first; i < last; ++i)
+			{
+				vec<D, T, Q> const d = v[i] - block.mean;
+				for(length_t x = 0; x < D; ++x)
+					block.m2[x] += d * d[x];
+			}
+
+			merge(block);
+		}
+	}
+
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void covarianceAccumulator<D, T, Q>::merge(covarianceAccumulator<D, T, Q> const& other)
+	{
+		if(other.count == 0)
+			return;
+		if(count == 0)
+		{
+			*this = other;
+			return;
+		}
+
+		// Chan et al.: the sums of both sides plus the spread between their means
+		size_t const n = count + other.count;
+		vec<D, T, Q> const delta = other.mean - mean;
+		T const otherWeight = static_cast<T>(other.count) / static_cast<T>(n);
+		vec<D, T, Q> const scaled = delta * (static_cast<T>(count) * otherWeight);
+
+		mean += delta * otherWeight;
+		for(length_t x = 0; x < D; ++x)
+			m2[x] += other.m2[x] + delta * scaled[x];
+		count = n;
+	}
+
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<D, D, T, Q> covarianceAccumulator<D, T, Q>::covariance() const
+	{
+		if(count == 0)
+			return mat<D, D, T, Q>(static_cast<T>(0));
+		return m2 / static_cast<T>(count);
+	}
+
 	namespace _internal_
 	{
 
@@ -89,194 +169,295 @@ namespace glm {
 			return absb * glm::sqrt(static_cast<T>(1) + absa);
 		}
 
-	}
-
-	template<length_t D, typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER unsigned int findEigenvaluesSymReal
-	(
-		mat<D, D, T, Q> const& covarMat,
-		vec<D, T, Q>& outEigenvalues,
-		mat<D, D, T, Q>& outEigenvectors
-	)
-	{
-		using _internal_::transferSign;
-		using _internal_::pythag;
+		// Householder reduction to tridiagonal form followed by the QL algorithm
+		template<length_t D, typename T, qualifier Q>
+		struct compute_findEigenvaluesSymReal
+		{
+			GLM_FUNC_QUALIFIER static unsigned int call
+			(
+				mat<D, D, T, Q> const& covarMat,
+				vec<D, T, Q>& outEigenvalues,
+				mat<D, D, T, Q>& outEigenvectors
+			)
+			{
+				using _internal_::transferSign;
+				using _internal_::pythag;
 
-		T a[D * D]; // matrix -- input and workspace for algorithm (will be changed inplace)
-		T d[D]; // diagonal elements
-		T e[D]; // off-diagonal elements
+				T a[D * D]; // matrix -- input and workspace for algorithm (will be changed inplace)
+				T d[D]; // diagonal elements
+				T e[D]; // off-diagonal elements
 
-		for(length_t r = 0; r < D; r++)
-			for(length_t c = 0; c < D; c++)
-				a[(r) * D + (c)] = covarMat[c][r];
+				for(length_t r = 0; r < D; r++)
+					for(length_t c = 0; c < D; c++)
+						a[(r) * D + (c)] = covarMat[c][r];
 
-		// 1. Householder reduction.
-		length_t l, k, j, i;
-		T scale, hh, h, g, f;
-		static const T epsilon = static_cast<T>(0.0000001);
+				// 1. Householder reduction.
+				length_t l, k, j, i;
+				T scale, hh, h, g, f;
+				static const T epsilon = static_cast<T>(0.0000001);
 
-		for(i = D; i >= 2; i--)
-		{
-			l = i - 1;
-			h = scale = 0;
-			if(l > 1)
-			{
-				for(k = 1; k <= l; k++)
+				for(i = D; i >= 2; i--)
 				{
-					scale += glm::abs(a[(i - 1) * D + (k - 1)]);
-				}
-				if(glm::equal<T>(scale, 0, epsilon))
-				{
-					e[i - 1] = a[(i - 1) * D + (l - 1)];
-				}
-				else
-				{
-					for(k = 1; k <= l; k++)
-					{
-						a[(i - 1) * D + (k - 1)] /= scale;
-						h += a[(i - 1) * D + (k - 1)] * a[(i - 1) * D + (k - 1)];
-					}
-					f = a[(i - 1) * D + (l - 1)];
-					g = ((f >= 0) ? -glm::sqrt(h) : glm::sqrt(h));
-					e[i - 1] = scale * g;
-					h -= f * g;
-					a[(i - 1) * D + (l - 1)] = f - g;
-					f = 0;
-					for(j = 1; j <= l; j++)
+					l = i - 1;
+					h = scale = 0;
+					if(l > 1)
 					{
-						a[(j - 1) * D + (i - 1)] = a[(i - 1) * D + (j - 1)] / h;
-						g = 0;
-						for(k = 1; k <= j; k++)
+						for(k = 1; k <= l; k++)
 						{
-							g += a[(j - 1) * D + (k - 1)] * a[(i - 1) * D + (k - 1)];
+							scale += glm::abs(a[(i - 1) * D + (k - 1)]);
 						}
-						for(k = j + 1; k <= l; k++)
+						if(glm::equal<T>(scale, 0, epsilon))
 						{
-							g += a[(k - 1) * D + (j - 1)] * a[(i - 1) * D + (k - 1)];
+							e[i - 1] = a[(i - 1) * D + (l - 1)];
 						}
-						e[j - 1] = g / h;
-						f += e[j - 1] * a[(i - 1) * D + (j - 1)];
-					}
-					hh = f / (h + h);
-					for(j = 1; j <= l; j++)
-					{
-						f = a[(i - 1) * D + (j - 1)];
-						e[j - 1] = g = e[j - 1] - hh * f;
-						for(k = 1; k <= j; k++)
+						else
 						{
-							a[(j - 1) * D + (k - 1)] -= (f * e[k - 1] + g * a[(i - 1) * D + (k - 1)]);
+							for(k = 1; k <= l; k++)
+							{
+								a[(i - 1) * D + (k - 1)] /= scale;
+								h += a[(i - 1) * D + (k - 1)] * a[(i - 1) * D + (k - 1)];
+							}
+							f = a[(i - 1) * D + (l - 1)];
+							g = ((f >= 0) ? -glm::sqrt(h) : glm::sqrt(h));
+							e[i - 1] = scale * g;
+							h -= f * g;
+							a[(i - 1) * D + (l - 1)] = f - g;
+							f = 0;
+							for(j = 1; j <= l; j++)
+							{
+								a[(j - 1) * D + (i - 1)] = a[(i - 1) * D + (j - 1)] / h;
+								g = 0;
+								for(k = 1; k <= j; k++)
+								{
+									g += a[(j - 1) * D + (k - 1)] * a[(i - 1) * D + (k - 1)];
+								}
+								for(k = j + 1; k <= l; k++)
+								{
+									g += a[(k - 1) * D + (j - 1)] * a[(i - 1) * D + (k - 1)];
+								}
+								e[j - 1] = g / h;
+								f += e[j - 1] * a[(i - 1) * D + (j - 1)];
+							}
+							hh = f / (h + h);
+							for(j = 1; j <= l; j++)
+							{
+								f = a[(i - 1) * D + (j - 1)];
+								e[j - 1] = g = e[j - 1] - hh * f;
+								for(k = 1; k <= j; k++)
+								{
+									a[(j - 1) * D + (k - 1)] -= (f * e[k - 1] + g * a[(i - 1) * D + (k - 1)]);
+								}
+							}
 						}
 					}
+					else
+					{
+						e[i - 1] = a[(i - 1) * D + (l - 1)];
+					}
+					d[i - 1] = h;
 				}
-			}
-			else
-			{
-				e[i - 1] = a[(i - 1) * D + (l - 1)];
-			}
-			d[i - 1] = h;
-		}
-		d[0] = 0;
-		e[0] = 0;
-		for(i = 1; i <= D; i++)
-		{
-			l = i - 1;
-			if(!glm::equal<T>(d[i - 1], 0, epsilon))
-			{
-				for(j = 1; j <= l; j++)
+				d[0] = 0;
+				e[0] = 0;
+				for(i = 1; i <= D; i++)
 				{
-					g = 0;
-					for(k = 1; k <= l; k++)
+					l = i - 1;
+					if(!glm::equal<T>(d[i - 1], 0, epsilon))
 					{
-						g += a[(i - 1) * D + (k - 1)] * a[(k - 1) * D + (j - 1)];
+						for(j = 1; j <= l; j++)
+						{
+							g = 0;
+							for(k = 1; k <= l; k++)
+							{
+								g += a[(i - 1) * D + (k - 1)] * a[(k - 1) * D + (j - 1)];
+							}
+							for(k = 1; k <= l; k++)
+							{
+								a[(k - 1) * D + (j - 1)] -= g * a[(k - 1) * D + (i - 1)];
+							}
+						}
 					}
-					for(k = 1; k <= l; k++)
+					d[i - 1] = a[(i - 1) * D + (i - 1)];
+					a[(i - 1) * D + (i - 1)] = 1;
+					for(j = 1; j <= l; j++)
 					{
-						a[(k - 1) * D + (j - 1)] -= g * a[(k - 1) * D + (i - 1)];
+						a[(j - 1) * D + (i - 1)] = a[(i - 1) * D + (j - 1)] = 0;
 					}
 				}
-			}
-			d[i - 1] = a[(i - 1) * D + (i - 1)];
-			a[(i - 1) * D + (i - 1)] = 1;
-			for(j = 1; j <= l; j++)
-			{
-				a[(j - 1) * D + (i - 1)] = a[(i - 1) * D + (j - 1)] = 0;
-			}
-		}
 
-		// 2. Calculation of eigenvalues and eigenvectors (QL algorithm)
-		length_t m, iter;
-		T s, r, p, dd, c, b;
-		const length_t MAX_ITER = 30;
+				// 2. Calculation of eigenvalues and eigenvectors (QL algorithm)
+				length_t m, iter;
+				T s, r, p, dd, c, b;
+				const length_t MAX_ITER = 30;
 
-		for(i = 2; i <= D; i++)
-		{
-			e[i - 2] = e[i - 1];
-		}
-		e[D - 1] = 0;
-
-		for(l = 1; l <= D; l++)
-		{
-			iter = 0;
-			do
-			{
-				for(m = l; m <= D - 1; m++)
+				for(i = 2; i <= D; i++)
 				{
-					dd = glm::abs(d[m - 1]) + glm::abs(d[m - 1 + 1]);
-					if(glm::equal<T>(glm::abs(e[m - 1]) + dd, dd, epsilon))
-						break;
+					e[i - 2] = e[i - 1];
 				}
-				if(m != l)
+				e[D - 1] = 0;
+
+				for(l = 1; l <= D; l++)
 				{
-					if(iter++ == MAX_ITER)
+					iter = 0;
+					do
+					{
+						for(m = l; m <= D - 1; m++)
+						{
+							dd = glm::abs(d[m - 1]) + glm::abs(d[m - 1 + 1]);
+							if(glm::equal<T>(glm::abs(e[m - 1]) + dd, dd, epsilon))
+								break;
+						}
+						if(m != l)
+						{
+							if(iter++ == MAX_ITER)
+							{
+								return 0; // Too many iterations in FindEigenvalues
+							}
+							g = (d[l - 1 + 1] - d[l - 1]) / (2 * e[l - 1]);
+							r = pythag<T>(g, 1);
+							g = d[m - 1] - d[l - 1] + e[l - 1] / (g + transferSign(r, g));
+							s = c = 1;
+							p = 0;
+							for(i = m - 1; i >= l; i--)
+							{
+								f = s * e[i - 1];
+								b = c * e[i - 1];
+								e[i - 1 + 1] = r = pythag(f, g);
+								if(glm::equal<T>(r, 0, epsilon))
+								{
+									d[i - 1 + 1] -= p;
+									e[m - 1] = 0;
+									break;
+								}
+								s = f / r;
+								c = g / r;
+								g = d[i - 1 + 1] - p;
+								r = (d[i - 1] - g) * s + 2 * c * b;
+								d[i - 1 + 1] = g + (p = s * r);
+								g = c * r - b;
+								for(k = 1; k <= D; k++)
+								{
+									f = a[(k - 1) * D + (i - 1 + 1)];
+									a[(k - 1) * D + (i - 1 + 1)] = s * a[(k - 1) * D + (i - 1)] + c * f;
+									a[(k - 1) * D + (i - 1)] = c * a[(k - 1) * D + (i - 1)] - s * f;
+								}
+							}
+							if(glm::equal<T>(r, 0, epsilon) && (i >= l))
+								continue;
+							d[l - 1] -= p;
+							e[l - 1] = g;
+							e[m - 1] = 0;
+						}
+					} while(m != l);
+				}
+
+				// 3. output
+				for(i = 0; i < D; i++)
+					outEigenvalues[i] = d[i];
+				for(i = 0; i < D; i++)
+					for(j = 0; j < D; j++)
+						outEigenvectors[i][j] = a[(j) * D + (i)];
+
+				return D;
+			}
+		};
+
+		// Cyclic Jacobi: every rotation zeroes one off-diagonal element. For 3x3 it
+		// converges in a few sweeps and is more accurate than the tridiagonal path.
+		template<typename T, qualifier Q>
+		struct compute_findEigenvaluesSymReal<3, T, Q>
+		{
+			GLM_FUNC_QUALIFIER static unsigned int call
+			(
+				mat<3, 3, T, Q> const& covarMat,
+				vec<3, T, Q>& outEigenvalues,
+				mat<3, 3, T, Q>& outEigenvectors
+			)
+			{
+				T a[3][3]; // a[row][column], diagonalized in place
+				T v[3][3]; // accumulated rotations, eigenvectors as columns
+				for(length_t r = 0; r < 3; r++)
+					for(length_t c = 0; c < 3; c++)
 					{
-						return 0; // Too many iterations in FindEigenvalues
+						a[r][c] = covarMat[c][r];
+						v[r][c] = static_cast<T>(r == c ? 1 : 0);
 					}
-					g = (d[l - 1 + 1] - d[l - 1]) / (2 * e[l - 1]);
-					r = pythag<T>(g, 1);
-					g = d[m - 1] - d[l - 1] + e[l - 1] / (g + transferSign(r, g));
-					s = c = 1;
-					p = 0;
-					for(i = m - 1; i >= l; i--)
+
+				static const int MAX_SWEEPS = 50;
+				static const length_t pairs[3][2] = {{0, 1}, {0, 2}, {1, 2}};
+				int sweep = 0;
+				for(; sweep < MAX_SWEEPS; ++sweep)
+				{
+					if(a[0][1] == static_cast<T>(0) && a[0][2] == static_cast<T>(0) && a[1][2] == static_cast<T>(0))
+						break;
+
+					for(int i = 0; i < 3; ++i)
 					{
-						f = s * e[i - 1];
-						b = c * e[i - 1];
-						e[i - 1 + 1] = r = pythag(f, g);
-						if(glm::equal<T>(r, 0, epsilon))
+						length_t const p = pairs[i][0];
+						length_t const q = pairs[i][1];
+						T const apq = a[p][q];
+
+						// negligible next to both diagonal elements: drop it
+						T const small = glm::abs(apq) * static_cast<T>(100);
+						if(sweep > 3 && glm::abs(a[p][p]) + small == glm::abs(a[p][p]) && glm::abs(a[q][q]) + small == glm::abs(a[q][q]))
 						{
-							d[i - 1 + 1] -= p;
-							e[m - 1] = 0;
-							break;
+							a[p][q] = a[q][p] = static_cast<T>(0);
+							continue;
 						}
-						s = f / r;
-						c = g / r;
-						g = d[i - 1 + 1] - p;
-						r = (d[i - 1] - g) * s + 2 * c * b;
-						d[i - 1 + 1] = g + (p = s * r);
-						g = c * r - b;
-						for(k = 1; k <= D; k++)
+						if(apq == static_cast<T>(0))
+							continue;
+
+						T const theta = (a[q][q] - a[p][p]) / (static_cast<T>(2) * apq);
+						T const root = glm::sqrt(theta * theta + static_cast<T>(1));
+						T const t = (theta >= static_cast<T>(0) ? static_cast<T>(1) : static_cast<T>(-1)) / (glm::abs(theta) + root);
+						T const c = static_cast<T>(1) / glm::sqrt(t * t + static_cast<T>(1));
+						T const s = t * c;
+						T const tau = s / (static_cast<T>(1) + c);
+
+						// written as small corrections to the old values, which loses less precision than c * x - s * y
+						a[p][p] -= t * apq;
+						a[q][q] += t * apq;
+
+						length_t const r = 3 - p - q;
+						T const arp = a[r][p];
+						T const arq = a[r][q];
+						a[r][p] = a[p][r] = arp - s * (arq + tau * arp);
+						a[r][q] = a[q][r] = arq + s * (arp - tau * arq);
+
+						for(length_t k = 0; k < 3; ++k)
 						{
-							f = a[(k - 1) * D + (i - 1 + 1)];
-							a[(k - 1) * D + (i - 1 + 1)] = s * a[(k - 1) * D + (i - 1)] + c * f;
-							a[(k - 1) * D + (i - 1)] = c * a[(k - 1) * D + (i - 1)] - s * f;
+							T const vkp = v[k][p];
+							T const vkq = v[k][q];
+							v[k][p] = vkp - s * (vkq + tau * vkp);
+							v[k][q] = vkq + s * (vkp - tau * vkq);
 						}
+						// zero by construction
+						a[p][q] = a[q][p] = static_cast<T>(0);
 					}
-					if(glm::equal<T>(r, 0, epsilon) && (i >= l))
-						continue;
-					d[l - 1] -= p;
-					e[l - 1] = g;
-					e[m - 1] = 0;
 				}
-			} while(m != l);
-		}
+				if(sweep == MAX_SWEEPS)
+					return 0;
 
-		// 3. output
-		for(i = 0; i < D; i++)
-			outEigenvalues[i] = d[i];
-		for(i = 0; i < D; i++)
-			for(j = 0; j < D; j++)
-				outEigenvectors[i][j] = a[(j) * D + (i)];
+				for(length_t i = 0; i < 3; i++)
+					outEigenvalues[i] = a[i][i];
+				for(length_t i = 0; i < 3; i++)
+					for(length_t j = 0; j < 3; j++)
+						outEigenvectors[i][j] = v[j][i];
+
+				return 3;
+			}
+		};
 
-		return D;
+	}//namespace _internal_
+
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER unsigned int findEigenvaluesSymReal
+	(
+		mat<D, D, T, Q> const& covarMat,
+		vec<D, T, Q>& outEigenvalues,
+		mat<D, D, T, Q>& outEigenvectors
+	)
+	{
+		return _internal_::compute_findEigenvaluesSymReal<D, T, Q>::call(covarMat, outEigenvalues, outEigenvectors);
 	}
 
 	template<typename T, qualifier Q>
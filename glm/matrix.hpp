@@ -159,3 +159,21 @@ namespace detail
 }//namespace glm
 
 #include "detail/func_matrix.inl"
+
+#if GLM_CONFIG_EXTERN_TEMPLATE == GLM_ENABLE
+namespace glm
+{
+	extern template mat<3, 3, float, packed_highp> transpose(mat<3, 3, float, packed_highp> const&);
+	extern template float determinant(mat<3, 3, float, packed_highp> const&);
+	extern template mat<3, 3, float, packed_highp> inverse(mat<3, 3, float, packed_highp> const&);
+	extern template mat<3, 3, double, packed_highp> transpose(mat<3, 3, double, packed_highp> const&);
+	extern template double determinant(mat<3, 3, double, packed_highp> const&);
+	extern template mat<3, 3, double, packed_highp> inverse(mat<3, 3, double, packed_highp> const&);
+	extern template mat<4, 4, float, packed_highp> transpose(mat<4, 4, float, packed_highp> const&);
+	extern template float determinant(mat<4, 4, float, packed_highp> const&);
+	extern template mat<4, 4, float, packed_highp> inverse(mat<4, 4, float, packed_highp> const&);
+	extern template mat<4, 4, double, packed_highp> transpose(mat<4, 4, double, packed_highp> const&);
+	extern template double determinant(mat<4, 4, double, packed_highp> const&);
+	extern template mat<4, 4, double, packed_highp> inverse(mat<4, 4, double, packed_highp> const&);
+}//namespace glm
+#endif//GLM_CONFIG_EXTERN_TEMPLATE
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "platform.h"
+#include "common.h"
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
@@ -17,4 +18,148 @@ GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sqrt_lowp(glm_f32vec4 x)
 	return _mm_mul_ps(_mm_rsqrt_ps(x), x);
 }
 
+// log2 of positive normal x, within 3 ulp: the exponent comes from the bits, the mantissa
+// is moved to [sqrt(1/2), sqrt(2)) and log2(m) = s * P(s^2) with s = (m - 1) / (m + 1)
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_log2_lowp(glm_f32vec4 x)
+{
+	glm_i32vec4 const Bits = _mm_castps_si128(x);
+	glm_i32vec4 const Exponent = _mm_srai_epi32(_mm_sub_epi32(Bits, _mm_set1_epi32(0x3F3504F3)), 23);
+	glm_f32vec4 const m = _mm_castsi128_ps(_mm_sub_epi32(Bits, _mm_slli_epi32(Exponent, 23)));
+	glm_f32vec4 const One = _mm_set1_ps(1.0f);
+	glm_f32vec4 const s = _mm_div_ps(_mm_sub_ps(m, One), _mm_add_ps(m, One));
+	glm_f32vec4 const z = _mm_mul_ps(s, s);
+	glm_f32vec4 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(0.431735879f), z), _mm_set1_ps(0.576714384f));
+	p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(0.961798848f));
+	p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(2.88539008f));
+	return _mm_add_ps(_mm_cvtepi32_ps(Exponent), _mm_mul_ps(s, p));
+}
+
+// 2^x for x in [-126, 127], within 3 ulp: 2^floor(x) goes into the exponent bits,
+// 2^fract(x) is a degree 5 polynomial
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_exp2_lowp(glm_f32vec4 x)
+{
+	glm_f32vec4 const Clamped = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-126.0f)), _mm_set1_ps(127.0f));
+	// truncation of a positive value is floor
+	glm_i32vec4 const Whole = _mm_sub_epi32(_mm_cvttps_epi32(_mm_add_ps(Clamped, _mm_set1_ps(126.0f))), _mm_set1_epi32(126));
+	glm_f32vec4 const f = _mm_sub_ps(Clamped, _mm_cvtepi32_ps(Whole));
+	glm_f32vec4 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(0.00187757670f), f), _mm_set1_ps(0.00898934002f));
+	p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(0.0558263181f));
+	p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(0.240153617f));
+	p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(0.693153073f));
+	p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(0.999999925f));
+	return _mm_castsi128_ps(_mm_add_epi32(_mm_castps_si128(p), _mm_slli_epi32(Whole, 23)));
+}
+
+// x * 2^n, with 2^n applied in two halves so that results from 2^-149 up to overflow are reached
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_ldexp(glm_f32vec4 x, glm_i32vec4 n)
+{
+	glm_i32vec4 const Half = _mm_srai_epi32(n, 1);
+	glm_i32vec4 const Bias = _mm_set1_epi32(127);
+	glm_f32vec4 const ScaleA = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(Half, Bias), 23));
+	glm_f32vec4 const ScaleB = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_sub_epi32(n, Half), Bias), 23));
+	return _mm_mul_ps(_mm_mul_ps(x, ScaleA), ScaleB);
+}
+
+// e^x within 1.3 ulp for every float, flushing to 0 below -103.9 and +inf above 88.72.
+// n = round(x / ln2) and r = x - n * ln2 in two parts, e^r is a degree 7 polynomial on [-ln2/2, ln2/2]
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_exp(glm_f32vec4 x)
+{
+	// max/min order keeps NaN
+	glm_f32vec4 const Clamped = _mm_min_ps(_mm_set1_ps(89.0f), _mm_max_ps(_mm_set1_ps(-104.0f), x));
+	glm_i32vec4 const n = _mm_cvtps_epi32(_mm_mul_ps(Clamped, _mm_set1_ps(1.44269504088896341f)));
+	glm_f32vec4 const nf = _mm_cvtepi32_ps(n);
+	glm_f32vec4 r = glm_vec4_fma(nf, _mm_set1_ps(-0.693359375f), Clamped);
+	r = glm_vec4_fma(nf, _mm_set1_ps(2.12194440e-4f), r);
+	glm_f32vec4 p = glm_vec4_fma(_mm_set1_ps(1.9875691500e-4f), r, _mm_set1_ps(1.3981999507e-3f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(8.3334519073e-3f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(4.1665795894e-2f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(1.6666665459e-1f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(5.0000001201e-1f));
+	p = glm_vec4_fma(p, _mm_mul_ps(r, r), _mm_add_ps(r, _mm_set1_ps(1.0f)));
+	return glm_vec4_ldexp(p, n);
+}
+
+// 2^x within 1.3 ulp for every float, flushing to 0 below -150 and +inf from 128.
+// n = round(x), 2^(x - n) is a degree 6 polynomial on [-1/2, 1/2]
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_exp2(glm_f32vec4 x)
+{
+	glm_f32vec4 const Clamped = _mm_min_ps(_mm_set1_ps(129.0f), _mm_max_ps(_mm_set1_ps(-151.0f), x));
+	glm_i32vec4 const n = _mm_cvtps_epi32(Clamped);
+	glm_f32vec4 const r = _mm_sub_ps(Clamped, _mm_cvtepi32_ps(n));
+	glm_f32vec4 p = glm_vec4_fma(_mm_set1_ps(1.535336188319500e-4f), r, _mm_set1_ps(1.339887440266574e-3f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(9.618437357674640e-3f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(5.550332471162809e-2f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(2.402264791363012e-1f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(6.931472028550421e-1f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(1.0f));
+	return glm_vec4_ldexp(p, n);
+}
+
+// Splits positive x into 2^e * (1 + f) with 1 + f in [sqrt(1/2), sqrt(2)) and returns
+// log(1 + f) - f, with log(1 + f) = f - f^2 / 2 + f^3 * P(f) and P of degree 8.
+// Denormals are scaled up first; zero, negative, infinite and NaN inputs are left to the caller.
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_log_reduce(glm_f32vec4 x, glm_f32vec4& f, glm_f32vec4& e)
+{
+	glm_f32vec4 const Denormal = _mm_cmplt_ps(x, _mm_set1_ps(1.17549435e-38f));
+	glm_f32vec4 const Scaled = _mm_or_ps(_mm_and_ps(Denormal, _mm_mul_ps(x, _mm_set1_ps(8388608.0f))), _mm_andnot_ps(Denormal, x));
+	glm_i32vec4 const Bits = _mm_castps_si128(Scaled);
+	// mantissa in [0.5, 1), then doubled below sqrt(1/2)
+	glm_f32vec4 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(Bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F000000)));
+	glm_f32vec4 const Small = _mm_cmplt_ps(m, _mm_set1_ps(0.707106781186547524f));
+	glm_i32vec4 Exponent = _mm_sub_epi32(_mm_srli_epi32(Bits, 23), _mm_set1_epi32(126));
+	Exponent = _mm_add_epi32(Exponent, _mm_castps_si128(Small));
+	e = _mm_sub_ps(_mm_cvtepi32_ps(Exponent), _mm_and_ps(Denormal, _mm_set1_ps(23.0f)));
+	f = _mm_sub_ps(_mm_add_ps(m, _mm_and_ps(Small, m)), _mm_set1_ps(1.0f));
+
+	glm_f32vec4 const z = _mm_mul_ps(f, f);
+	glm_f32vec4 p = glm_vec4_fma(_mm_set1_ps(7.0376836292e-2f), f, _mm_set1_ps(-1.1514610310e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(1.1676998740e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(-1.2420140846e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(1.4249322787e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(-1.6668057665e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(2.0000714765e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(-2.4999993993e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(3.3333331174e-1f));
+	return glm_vec4_fma(_mm_mul_ps(p, f), z, _mm_mul_ps(z, _mm_set1_ps(-0.5f)));
+}
+
+// log(0) is -inf, log of a negative number is NaN, +inf and NaN go through
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_log_special(glm_f32vec4 x, glm_f32vec4 Result)
+{
+	glm_f32vec4 const Zero = _mm_setzero_ps();
+	glm_f32vec4 const Inf = _mm_castsi128_ps(_mm_set1_epi32(0x7F800000));
+	glm_f32vec4 const IsZero = _mm_cmpeq_ps(x, Zero);
+	glm_f32vec4 const IsPassed = _mm_or_ps(_mm_cmpeq_ps(x, Inf), _mm_cmpunord_ps(x, x));
+	Result = _mm_or_ps(_mm_and_ps(IsZero, _mm_sub_ps(Zero, Inf)), _mm_andnot_ps(IsZero, Result));
+	Result = _mm_or_ps(Result, _mm_cmplt_ps(x, Zero));
+	return _mm_or_ps(_mm_and_ps(IsPassed, x), _mm_andnot_ps(IsPassed, Result));
+}
+
+// natural logarithm within 0.9 ulp for every positive float, denormals included
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_log(glm_f32vec4 x)
+{
+	glm_f32vec4 f, e;
+	glm_f32vec4 const y = glm_vec4_log_reduce(x, f, e);
+	// e * ln2 in two parts
+	glm_f32vec4 Result = glm_vec4_fma(e, _mm_set1_ps(-2.12194440e-4f), y);
+	Result = _mm_add_ps(f, Result);
+	Result = glm_vec4_fma(e, _mm_set1_ps(0.693359375f), Result);
+	return glm_vec4_log_special(x, Result);
+}
+
+// base 2 logarithm within 1.4 ulp for every positive float, denormals included
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_log2(glm_f32vec4 x)
+{
+	glm_f32vec4 f, e;
+	glm_f32vec4 const y = glm_vec4_log_reduce(x, f, e);
+	// (f + y) * log2(e) with log2(e) = 1 + 0.4426950... to keep the leading term exact
+	glm_f32vec4 const Log2eMinusOne = _mm_set1_ps(0.44269504088896340736f);
+	glm_f32vec4 Result = _mm_mul_ps(y, Log2eMinusOne);
+	Result = glm_vec4_fma(f, Log2eMinusOne, Result);
+	Result = _mm_add_ps(Result, y);
+	Result = _mm_add_ps(Result, f);
+	Result = _mm_add_ps(Result, e);
+	return glm_vec4_log_special(x, Result);
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -467,3 +467,14 @@
 	typedef int32x4_t			glm_i32vec4;
 	typedef uint32x4_t			glm_u32vec4;
 #endif
+
+// Half precision conversion instructions. F16C is its own CPUID bit on x86: GCC and Clang only
+// allow it with -mf16c (or a -march that has it), MSVC with /arch:AVX2 as every AVX2 CPU has it.
+// AArch64 always converts between half and float, 32-bit ARM needs the fp16 format extension.
+#if (GLM_ARCH & GLM_ARCH_AVX_BIT) && (defined(__F16C__) || ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_ARCH & GLM_ARCH_AVX2_BIT)))
+#	define GLM_HAS_HALF_INTRINSICS 1
+#elif (GLM_ARCH & GLM_ARCH_NEON_BIT) && (defined(__aarch64__) || defined(_M_ARM64) || (defined(__ARM_FP) && (__ARM_FP & 2)))
+#	define GLM_HAS_HALF_INTRINSICS 1
+#else
+#	define GLM_HAS_HALF_INTRINSICS 0
+#endif
@@ -3,7 +3,95 @@
 
 #pragma once
 
+#include "platform.h"
+#include "common.h"
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+// x - q * pi/2 with q = round(x * 2/pi), pi/2 split in three parts. The first two products are
+// exact while |q| < 2^11, so the result is accurate for |x| up to about 8192.
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_reduce_half_pi(glm_f32vec4 x, glm_i32vec4& q)
+{
+	q = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(0.636619772367581343f)));
+	glm_f32vec4 const qf = _mm_cvtepi32_ps(q);
+	glm_f32vec4 r = glm_vec4_fma(qf, _mm_set1_ps(-1.5703125f), x);
+	r = glm_vec4_fma(qf, _mm_set1_ps(-4.837512969970703125e-4f), r);
+	return glm_vec4_fma(qf, _mm_set1_ps(-7.54978995489188216e-8f), r);
+}
+
+// sin(r + q * pi/2) given sin(r) and cos(r)
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sin_quadrant(glm_f32vec4 s, glm_f32vec4 c, glm_i32vec4 q)
+{
+	glm_f32vec4 const Odd = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+	glm_f32vec4 const Sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30));
+	return _mm_xor_ps(_mm_or_ps(_mm_and_ps(Odd, c), _mm_andnot_ps(Odd, s)), Sign);
+}
+
+// sin(r) on [-pi/4, pi/4], r + r^3 * P(r^2) with P of degree 2
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sin_poly(glm_f32vec4 r)
+{
+	glm_f32vec4 const z = _mm_mul_ps(r, r);
+	glm_f32vec4 p = glm_vec4_fma(_mm_set1_ps(-1.9515295891e-4f), z, _mm_set1_ps(8.3321608736e-3f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(-1.6666654611e-1f));
+	return glm_vec4_fma(_mm_mul_ps(p, z), r, r);
+}
+
+// cos(r) on [-pi/4, pi/4], 1 - r^2 / 2 + r^4 * P(r^2) with P of degree 2
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_cos_poly(glm_f32vec4 r)
+{
+	glm_f32vec4 const z = _mm_mul_ps(r, r);
+	glm_f32vec4 p = glm_vec4_fma(_mm_set1_ps(2.443315711809948e-5f), z, _mm_set1_ps(-1.388731625493765e-3f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(4.166664568298827e-2f));
+	return glm_vec4_fma(_mm_mul_ps(p, z), z, glm_vec4_fma(z, _mm_set1_ps(-0.5f), _mm_set1_ps(1.0f)));
+}
+
+// sin(x) within 1.6 ulp, or 1e-7 absolute where the result is below 1e-3, for |x| <= 8192;
+// callers handle larger angles. Infinite and NaN inputs give NaN.
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sin(glm_f32vec4 x)
+{
+	glm_i32vec4 q;
+	glm_f32vec4 const r = glm_vec4_reduce_half_pi(x, q);
+	return glm_vec4_sin_quadrant(glm_vec4_sin_poly(r), glm_vec4_cos_poly(r), q);
+}
 
+// cos(x), same accuracy and range as glm_vec4_sin
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_cos(glm_f32vec4 x)
+{
+	glm_i32vec4 q;
+	glm_f32vec4 const r = glm_vec4_reduce_half_pi(x, q);
+	return glm_vec4_sin_quadrant(glm_vec4_sin_poly(r), glm_vec4_cos_poly(r), _mm_add_epi32(q, _mm_set1_epi32(1)));
+}
+
+// Shorter polynomials for the _lowp variants: sin(r) = r * P(r^2) and cos(r) = Q(r^2), both of degree 2
+// in r^2, with an absolute error below 1.2e-5 on [-pi/4, pi/4]
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sin_poly_lowp(glm_f32vec4 r)
+{
+	glm_f32vec4 const z = _mm_mul_ps(r, r);
+	glm_f32vec4 const p = glm_vec4_fma(_mm_set1_ps(8.15005656e-3f), z, _mm_set1_ps(-1.66623823e-1f));
+	return _mm_mul_ps(glm_vec4_fma(p, z, _mm_set1_ps(9.99998493e-1f)), r);
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_cos_poly_lowp(glm_f32vec4 r)
+{
+	glm_f32vec4 const z = _mm_mul_ps(r, r);
+	glm_f32vec4 const p = glm_vec4_fma(_mm_set1_ps(4.03622939e-2f), z, _mm_set1_ps(-4.99685485e-1f));
+	return glm_vec4_fma(p, z, _mm_set1_ps(9.99988217e-1f));
+}
+
+// sin(x) with an absolute error below 1.2e-5 for |x| <= 8192
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sin_lowp(glm_f32vec4 x)
+{
+	glm_i32vec4 q;
+	glm_f32vec4 const r = glm_vec4_reduce_half_pi(x, q);
+	return glm_vec4_sin_quadrant(glm_vec4_sin_poly_lowp(r), glm_vec4_cos_poly_lowp(r), q);
+}
+
+// cos(x), same accuracy and range as glm_vec4_sin_lowp
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_cos_lowp(glm_f32vec4 x)
+{
+	glm_i32vec4 q;
+	glm_f32vec4 const r = glm_vec4_reduce_half_pi(x, q);
+	return glm_vec4_sin_quadrant(glm_vec4_sin_poly_lowp(r), glm_vec4_cos_poly_lowp(r), _mm_add_epi32(q, _mm_set1_epi32(1)));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -10,6 +10,10 @@
 #include <glm/ext/vector_bool4.hpp>
 #include <glm/ext/vector_float1.hpp>
 #include <glm/vector_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <cmath>
 
 static int test_vec1()
 {
@@ -730,6 +734,69 @@ static int test_mat2x2()
 	return Error;
 }
 
+static int test_transform()
+{
+	int Error = 0;
+
+	{
+		constexpr glm::mat4 T = glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, 2.0f, 3.0f));
+		static_assert(T[3] == glm::vec4(1.0f, 2.0f, 3.0f, 1.0f), "GLM: Failed constexpr");
+
+		constexpr glm::mat4 S = glm::scale(T, glm::vec3(2.0f));
+		static_assert(S[0] == glm::vec4(2.0f, 0.0f, 0.0f, 0.0f), "GLM: Failed constexpr");
+		static_assert(S[3] == T[3], "GLM: Failed constexpr");
+
+		constexpr glm::mat4 O = glm::orthoRH_NO(-2.0f, 2.0f, -1.0f, 1.0f, 1.0f, 3.0f);
+		static_assert(O[0][0] == 0.5f && O[1][1] == 1.0f && O[2][2] == -1.0f && O[3][2] == -2.0f, "GLM: Failed constexpr");
+
+		constexpr glm::mat4 F = glm::frustumRH_NO(-1.0f, 1.0f, -1.0f, 1.0f, 1.0f, 3.0f);
+		static_assert(F[0][0] == 1.0f && F[2][3] == -1.0f && F[3][2] == -3.0f, "GLM: Failed constexpr");
+	}
+
+#	if GLM_HAS_CONSTANT_EVALUATED
+	{
+		constexpr glm::mat4 R = glm::rotate(glm::mat4(1.0f), glm::pi<float>() * 0.5f, glm::vec3(0.0f, 0.0f, 2.0f));
+		static_assert(R[0][1] > 0.9999f && R[0][0] < 1e-6f && R[0][0] > -1e-6f, "GLM: Failed constexpr");
+		glm::mat4 const r = glm::rotate(glm::mat4(1.0f), glm::pi<float>() * 0.5f, glm::vec3(0.0f, 0.0f, 2.0f));
+		Error += glm::all(glm::equal(R, r, glm::epsilon<float>())) ? 0 : 1;
+
+		constexpr glm::mat4 V = glm::lookAt(glm::vec3(0.0f, 7.0f, 18.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+		glm::mat4 const v = glm::lookAt(glm::vec3(0.0f, 7.0f, 18.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+		Error += glm::all(glm::equal(V, v, glm::epsilon<float>() * 16.0f)) ? 0 : 1;
+
+		constexpr glm::mat4 P = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+		glm::mat4 const p = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+		Error += glm::all(glm::equal(P, p, glm::epsilon<float>())) ? 0 : 1;
+
+		constexpr glm::dmat4 D = glm::perspectiveFov(glm::radians(60.0), 1280.0, 720.0, 0.1, 100.0);
+		glm::dmat4 const d = glm::perspectiveFov(glm::radians(60.0), 1280.0, 720.0, 0.1, 100.0);
+		Error += glm::all(glm::equal(D, d, glm::epsilon<double>() * 4.0)) ? 0 : 1;
+	}
+#	endif//GLM_HAS_CONSTANT_EVALUATED
+
+	return Error;
+}
+
+static int test_constexpr_math()
+{
+	int Error = 0;
+
+	for(int i = -2000; i <= 2000; ++i)
+	{
+		double const x = static_cast<double>(i) * 0.005;
+		Error += std::abs(glm::detail::constexpr_sin(x) - std::sin(x)) <= 4.0 * glm::epsilon<double>() ? 0 : 1;
+		Error += std::abs(glm::detail::constexpr_cos(x) - std::cos(x)) <= 4.0 * glm::epsilon<double>() ? 0 : 1;
+		Error += std::abs(glm::detail::constexpr_sin(static_cast<float>(x)) - std::sin(static_cast<float>(x))) <= glm::epsilon<float>() ? 0 : 1;
+
+		double const y = static_cast<double>(i + 2000) * 0.25;
+		Error += std::abs(glm::detail::constexpr_sqrt(y) - std::sqrt(y)) <= glm::epsilon<double>() * std::sqrt(y) ? 0 : 1;
+	}
+
+	Error += glm::detail::constexpr_tan(glm::quarter_pi<float>()) == std::tan(glm::quarter_pi<float>()) ? 0 : 1;
+
+	return Error;
+}
+
 #endif//GLM_CONFIG_CONSTEXP == GLM_ENABLE
 
 int main()
@@ -743,6 +810,8 @@ int main()
 		Error += test_vec4();
 		Error += test_quat();
 		Error += test_mat2x2();
+		Error += test_transform();
+		Error += test_constexpr_math();
 #	endif//GLM_CONFIG_CONSTEXP == GLM_ENABLE
 
 	return Error;
@@ -0,0 +1,46 @@
+import glm;
+
+static int test_vector()
+{
+	int Error = 0;
+
+	glm::vec4 const A(1.0f, 2.0f, 3.0f, 4.0f);
+	glm::vec4 const B = A * 2.0f - glm::vec4(1.0f);
+
+	Error += glm::all(glm::equal(B, glm::vec4(1.0f, 3.0f, 5.0f, 7.0f), glm::epsilon<float>())) ? 0 : 1;
+	Error += glm::abs(glm::dot(A, A) - 30.0f) < glm::epsilon<float>() ? 0 : 1;
+
+	return Error;
+}
+
+static int test_transform()
+{
+	int Error = 0;
+
+	glm::mat4 const Model = glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, 2.0f, 3.0f)), glm::radians(90.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+	glm::vec4 const P = Model * glm::vec4(1.0f, 0.0f, 0.0f, 1.0f);
+	Error += glm::all(glm::equal(P, glm::vec4(1.0f, 3.0f, 3.0f, 1.0f), 0.0001f)) ? 0 : 1;
+
+	glm::mat4 const Identity = glm::inverse(Model) * Model;
+	Error += glm::all(glm::equal(Identity, glm::mat4(1.0f), 0.0001f)) ? 0 : 1;
+
+	glm::mat4 const View = glm::lookAt(glm::vec3(0.0f, 0.0f, 5.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	glm::mat4 const Projection = glm::perspective(glm::radians(45.0f), 1.0f, 0.1f, 100.0f);
+	glm::vec4 const Clip = Projection * View * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+	Error += glm::abs(Clip.x) < 0.0001f && glm::abs(Clip.y) < 0.0001f && Clip.w > 0.0f ? 0 : 1;
+
+	glm::quat const Q = glm::angleAxis(glm::radians(90.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+	Error += glm::all(glm::equal(Q * glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f), 0.0001f)) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_vector();
+	Error += test_transform();
+
+	return Error;
+}
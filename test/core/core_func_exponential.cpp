@@ -7,6 +7,11 @@
 #include <glm/ext/vector_float4.hpp>
 #include <glm/common.hpp>
 #include <glm/exponential.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <cmath>
+#include <limits>
 
 static int test_pow()
 {
@@ -168,6 +173,69 @@ static int test_inversesqrt()
 	return Error;
 }
 
+// Within MaxULPs of the float nearest to the libm double result
+static int test_near(float Value, double Expected, int MaxULPs)
+{
+	return glm::equal(Value, static_cast<float>(Expected), MaxULPs) ? 0 : 1;
+}
+
+static double exp2_double(double x)
+{
+	return std::pow(2.0, x);
+}
+
+static double log2_double(double x)
+{
+	return std::log(x) / std::log(2.0);
+}
+
+// Without the C++11 STL, exp2 and log2 go through exp and log and are less accurate
+template<typename vec4Type>
+static int test_exp_log_ulp(bool TestBase2)
+{
+	int Error = 0;
+
+	for(float x = -87.f; x < 88.f; x += 0.00731f)
+	{
+		vec4Type const v(x, x * 0.5f, x * 0.03f, x * 1.4f);
+		vec4Type const e = glm::exp(v);
+		vec4Type const e2 = glm::exp2(v);
+		for(glm::length_t i = 0; i < 4; ++i)
+		{
+			Error += test_near(e[i], std::exp(static_cast<double>(v[i])), 2);
+			if(TestBase2)
+				Error += test_near(e2[i], exp2_double(static_cast<double>(v[i])), 2);
+		}
+	}
+
+	// Positive values from denormals to the largest float
+	for(float x = 1e-40f; x < 1.8e38f; x *= 1.00731f)
+	{
+		vec4Type const v(x, x * 1.5f, x * 1.75f, x * 1.875f);
+		vec4Type const l = glm::log(v);
+		vec4Type const l2 = glm::log2(v);
+		for(glm::length_t i = 0; i < 4; ++i)
+		{
+			Error += test_near(l[i], std::log(static_cast<double>(v[i])), 2);
+			if(TestBase2)
+				Error += test_near(l2[i], log2_double(static_cast<double>(v[i])), 2);
+		}
+	}
+
+	float const Inf = std::numeric_limits<float>::infinity();
+
+	vec4Type const e = glm::exp(vec4Type(-Inf, Inf, -200.f, 200.f));
+	Error += glm::all(glm::equal(glm::vec4(e.x, e.y, e.z, e.w), glm::vec4(0.f, Inf, 0.f, Inf), 0)) ? 0 : 1;
+
+	vec4Type const l = glm::log(vec4Type(0.f, Inf, -1.f, std::numeric_limits<float>::quiet_NaN()));
+	Error += glm::equal(l.x, -Inf, 0) ? 0 : 1;
+	Error += glm::equal(l.y, Inf, 0) ? 0 : 1;
+	Error += l.z != l.z ? 0 : 1;
+	Error += l.w != l.w ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -179,6 +247,10 @@ int main()
 	Error += test_exp2();
 	Error += test_log2();
 	Error += test_inversesqrt();
+	Error += test_exp_log_ulp<glm::vec4>(GLM_HAS_CXX11_STL);
+#	if GLM_CONFIG_SIMD == GLM_ENABLE
+		Error += test_exp_log_ulp<glm::aligned_vec4>(true);
+#	endif
 
 	return Error;
 }
@@ -1,10 +1,65 @@
 #include <glm/trigonometric.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/vector_float4.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <cmath>
+#include <limits>
 
-int main()
+// Within MaxULPs of the float nearest to the libm double result, or 1e-7 where the result is close to zero
+static int test_near(float Value, double Expected, int MaxULPs)
+{
+	if(std::abs(Expected) < 1e-3)
+		return std::abs(static_cast<double>(Value) - Expected) <= 1e-7 ? 0 : 1;
+	return glm::equal(Value, static_cast<float>(Expected), MaxULPs) ? 0 : 1;
+}
+
+template<typename vec4Type>
+static int test_sin_cos()
 {
 	int Error = 0;
 
+	for(float x = -8192.f; x < 8192.f; x += 0.0371f)
+	{
+		vec4Type const v(x, x * 0.5f, x * 0.125f, x * 0.001f);
+		vec4Type const s = glm::sin(v);
+		vec4Type const c = glm::cos(v);
+		for(glm::length_t i = 0; i < 4; ++i)
+		{
+			Error += test_near(s[i], std::sin(static_cast<double>(v[i])), 2);
+			Error += test_near(c[i], std::cos(static_cast<double>(v[i])), 2);
+		}
+	}
+
+	// Angles too large for the SIMD range reduction
+	vec4Type const Large(1e4f, -3e5f, 1e7f, 0.5f);
+	vec4Type const s = glm::sin(Large);
+	vec4Type const c = glm::cos(Large);
+	for(glm::length_t i = 0; i < 4; ++i)
+	{
+		Error += test_near(s[i], std::sin(static_cast<double>(Large[i])), 2);
+		Error += test_near(c[i], std::cos(static_cast<double>(Large[i])), 2);
+	}
+
+	vec4Type const Special(std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN(), 0.0f);
+	vec4Type const t = glm::sin(Special);
+	Error += t.x != t.x ? 0 : 1;
+	Error += t.y != t.y ? 0 : 1;
+	Error += t.z != t.z ? 0 : 1;
+	Error += glm::equal(t.w, 0.0f, 0) ? 0 : 1;
 
 	return Error;
 }
 
+int main()
+{
+	int Error = 0;
+
+	Error += test_sin_cos<glm::vec4>();
+#	if GLM_CONFIG_SIMD == GLM_ENABLE
+		Error += test_sin_cos<glm::aligned_vec4>();
+#	endif
+
+	return Error;
+}
@@ -110,6 +110,54 @@ static int test_Half4x16()
 	return Error;
 }
 
+static int test_HalfBuffer()
+{
+	int Error = 0;
+
+	// every half value, odd count so the scalar tail runs too
+	std::vector<glm::uint16> Halves(65535);
+	for(std::size_t i = 0; i < Halves.size(); ++i)
+		Halves[i] = static_cast<glm::uint16>(i);
+
+	std::vector<float> Floats(Halves.size());
+	glm::unpackHalf(&Halves[0], &Floats[0], Halves.size());
+
+	std::vector<glm::uint16> Packed(Halves.size());
+	glm::packHalf(&Floats[0], &Packed[0], Floats.size());
+
+	for(std::size_t i = 0; i < Halves.size(); ++i)
+	{
+		float const Value = glm::unpackHalf1x16(Halves[i]);
+		if(Value != Value) // NaN
+			Error += Floats[i] != Floats[i] ? 0 : 1;
+		else
+		{
+			Error += Floats[i] == Value ? 0 : 1;
+			Error += Packed[i] == Halves[i] ? 0 : 1;
+		}
+	}
+
+	// floats in between halves, rounding and overflow match the scalar conversion
+	std::vector<float> Values;
+	for(int i = -70000; i <= 70000; i += 7)
+		Values.push_back(static_cast<float>(i) * 1.001f);
+	for(int i = -1000; i <= 1000; ++i)
+		Values.push_back(static_cast<float>(i) * 0.000013f);
+
+	std::vector<glm::uint16> Converted(Values.size());
+	glm::packHalf(&Values[0], &Converted[0], Values.size());
+	for(std::size_t i = 0; i < Values.size(); ++i)
+		Error += Converted[i] == glm::packHalf1x16(Values[i]) ? 0 : 1;
+
+	for(std::size_t i = 0; i + 4 <= Values.size(); i += 4)
+	{
+		glm::vec4 const v(Values[i], Values[i + 1], Values[i + 2], Values[i + 3]);
+		Error += glm::all(glm::equal(glm::packHalf(v), glm::u16vec4(Converted[i], Converted[i + 1], Converted[i + 2], Converted[i + 3]))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
 static int test_I3x10_1x2()
 {
 	int Error = 0;
@@ -874,6 +922,7 @@ int main()
 	Error += test_U3x10_1x2();
 	Error += test_Half1x16();
 	Error += test_Half4x16();
+	Error += test_HalfBuffer();
 
 	return Error;
 }
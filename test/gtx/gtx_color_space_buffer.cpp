@@ -0,0 +1,163 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/color_space_buffer.hpp>
+#include <glm/gtx/color_space_YCoCg.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <cmath>
+#include <vector>
+
+static double srgbToLinear(double c)
+{
+	return c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4);
+}
+
+static double linearToSrgb(double c)
+{
+	return c < 0.0031308 ? c * 12.92 : 1.055 * std::pow(c, 1.0 / 2.4) - 0.055;
+}
+
+static int test_srgb8()
+{
+	int Error = 0;
+
+	std::vector<glm::u8vec4> Codes(256);
+	for(int i = 0; i < 256; ++i)
+		Codes[i] = glm::u8vec4(static_cast<glm::uint8>(i), static_cast<glm::uint8>(255 - i), static_cast<glm::uint8>(i), static_cast<glm::uint8>(i));
+
+	std::vector<glm::vec4> Linear(Codes.size());
+	glm::convertSRGBToLinear(Codes.data(), Linear.data(), Codes.size());
+
+	for(int i = 0; i < 256; ++i)
+	{
+		Error += glm::epsilonEqual(static_cast<double>(Linear[i].x), srgbToLinear(i / 255.0), 1e-7) ? 0 : 1;
+		Error += glm::epsilonEqual(static_cast<double>(Linear[i].y), srgbToLinear((255 - i) / 255.0), 1e-7) ? 0 : 1;
+		Error += glm::epsilonEqual(Linear[i].w, i / 255.0f, 1e-6f) ? 0 : 1;
+	}
+
+	// every code survives the round trip
+	std::vector<glm::u8vec4> Encoded(Codes.size());
+	glm::convertLinearToSRGB(Linear.data(), Encoded.data(), Linear.size());
+	for(int i = 0; i < 256; ++i)
+		Error += Encoded[i] == Codes[i] ? 0 : 1;
+
+	// out of range values are clamped
+	glm::vec4 const Out[2] = {glm::vec4(-1.0f, 2.0f, 0.5f, 3.0f), glm::vec4(0.0f, 1.0f, 0.0f, -1.0f)};
+	glm::u8vec4 Clamped[2];
+	glm::convertLinearToSRGB(Out, Clamped, 2);
+	Error += Clamped[0] == glm::u8vec4(0, 255, 188, 255) ? 0 : 1;
+	Error += Clamped[1] == glm::u8vec4(0, 255, 0, 0) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_srgb32f()
+{
+	int Error = 0;
+
+	std::size_t const Count = 4096;
+	std::vector<glm::vec4> Colors(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		float const c = static_cast<float>(i) / static_cast<float>(Count - 1);
+		Colors[i] = glm::vec4(c, c * c, 1.0f - c, c);
+	}
+
+	std::vector<glm::vec4> Linear(Count);
+	glm::convertSRGBToLinear(Colors.data(), Linear.data(), Count);
+	std::vector<glm::vec4> Encoded(Count);
+	glm::convertLinearToSRGB(Colors.data(), Encoded.data(), Count);
+
+	for(std::size_t i = 0; i < Count; ++i)
+		for(glm::length_t c = 0; c < 3; ++c)
+		{
+			double const Value = static_cast<double>(Colors[i][c]);
+			double const ExpectedLinear = srgbToLinear(Value);
+			double const ExpectedSRGB = linearToSrgb(Value);
+			Error += std::abs(Linear[i][c] - ExpectedLinear) <= 1.1e-6 * ExpectedLinear + 1e-9 ? 0 : 1;
+			Error += std::abs(Encoded[i][c] - ExpectedSRGB) <= 1.1e-6 * ExpectedSRGB + 1e-9 ? 0 : 1;
+		}
+
+	// alpha is untouched, and in place conversion works
+	Error += Linear[Count / 2].w == Colors[Count / 2].w ? 0 : 1;
+	glm::convertLinearToSRGB(Linear.data(), Linear.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::epsilonEqual(Linear[i], Colors[i], 2e-6f)) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_srgb16f()
+{
+	int Error = 0;
+
+	glm::u16vec3 const Colors[3] = {
+		glm::u16vec3(glm::packHalf1x16(0.0f), glm::packHalf1x16(0.5f), glm::packHalf1x16(1.0f)),
+		glm::u16vec3(glm::packHalf1x16(0.02f), glm::packHalf1x16(0.2f), glm::packHalf1x16(0.8f)),
+		glm::u16vec3(glm::packHalf1x16(0.001f), glm::packHalf1x16(0.04f), glm::packHalf1x16(0.3f))};
+
+	glm::u16vec3 Linear[3];
+	glm::convertSRGBToLinearHalf(Colors, Linear, 3);
+	glm::u16vec3 Encoded[3];
+	glm::convertLinearToSRGBHalf(Linear, Encoded, 3);
+
+	for(int i = 0; i < 3; ++i)
+		for(glm::length_t c = 0; c < 3; ++c)
+		{
+			double const Value = static_cast<double>(glm::unpackHalf1x16(Colors[i][c]));
+			Error += glm::epsilonEqual(static_cast<double>(glm::unpackHalf1x16(Linear[i][c])), srgbToLinear(Value), 1e-3 * srgbToLinear(Value) + 1e-7) ? 0 : 1;
+			Error += glm::epsilonEqual(static_cast<double>(glm::unpackHalf1x16(Encoded[i][c])), Value, 2e-3 * Value + 1e-6) ? 0 : 1;
+		}
+
+	return Error;
+}
+
+static int test_YCoCg()
+{
+	int Error = 0;
+
+	glm::vec4 const Colors[3] = {glm::vec4(1.0f, 0.5f, 0.0f, 1.0f), glm::vec4(0.2f, 0.4f, 0.8f, 0.5f), glm::vec4(0.0f)};
+	glm::vec4 YCoCg[3];
+	glm::rgb2YCoCg(Colors, YCoCg, 3);
+	glm::vec4 RGB[3];
+	glm::YCoCg2rgb(YCoCg, RGB, 3);
+
+	for(int i = 0; i < 3; ++i)
+	{
+		glm::vec3 const Expected = glm::rgb2YCoCg(glm::vec3(Colors[i]));
+		Error += glm::all(glm::epsilonEqual(glm::vec3(YCoCg[i]), Expected, 1e-6f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(RGB[i], Colors[i], 1e-6f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_XYZ()
+{
+	int Error = 0;
+
+	glm::vec4 const Colors[2] = {glm::vec4(1.0f, 1.0f, 1.0f, 0.25f), glm::vec4(0.3f, 0.6f, 0.1f, 1.0f)};
+	glm::vec4 XYZ[2];
+	glm::convertLinearSRGBToXYZ(Colors, XYZ, 2);
+
+	// white maps to the D65 white point
+	Error += glm::all(glm::epsilonEqual(XYZ[0], glm::vec4(0.95047f, 1.0f, 1.08883f, 0.25f), 1e-4f)) ? 0 : 1;
+
+	glm::vec4 RGB[2];
+	glm::convertXYZToLinearSRGB(XYZ, RGB, 2);
+	for(int i = 0; i < 2; ++i)
+		Error += glm::all(glm::epsilonEqual(RGB[i], Colors[i], 1e-5f)) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_srgb8();
+	Error += test_srgb32f();
+	Error += test_srgb16f();
+	Error += test_YCoCg();
+	Error += test_XYZ();
+
+	return Error;
+}
@@ -1,9 +1,68 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/fast_exponential.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#	include <algorithm>
+#	include <cmath>
+
+// Bounds documented for the SIMD path of aligned vec4, checked against libm in double
+static int test_simd()
+{
+	int Error = 0;
+
+	for(float x = -87.f; x < 87.f; x += 0.00731f)
+	{
+		glm::aligned_vec4 const v(x, x * 0.5f, x * 0.03f, -x);
+		glm::aligned_vec4 const e = glm::fastExp(v);
+		glm::aligned_vec4 const e2 = glm::fastExp2(v);
+		for(glm::length_t i = 0; i < 4; ++i)
+		{
+			double const Exp = std::exp(static_cast<double>(v[i]));
+			double const Exp2 = std::pow(2.0, static_cast<double>(v[i]));
+			Error += std::abs(e[i] - Exp) <= 5e-6 * Exp ? 0 : 1;
+			Error += std::abs(e2[i] - Exp2) <= 4e-7 * Exp2 ? 0 : 1;
+		}
+	}
+
+	for(float x = 1.2e-38f; x < 1.8e38f; x *= 1.00731f)
+	{
+		glm::aligned_vec4 const v(x, x * 1.5f, x * 1.75f, x * 1.875f);
+		glm::aligned_vec4 const l = glm::fastLog(v);
+		glm::aligned_vec4 const l2 = glm::fastLog2(v);
+		for(glm::length_t i = 0; i < 4; ++i)
+		{
+			double const Log = std::log(static_cast<double>(v[i]));
+			double const Log2 = Log / std::log(2.0);
+			Error += std::abs(l[i] - Log) <= 1e-5 ? 0 : 1;
+			Error += std::abs(l2[i] - Log2) <= 4e-7 * std::max(1.0, std::abs(Log2)) ? 0 : 1;
+		}
+	}
+
+	for(float x = 0.01f; x < 100.f; x *= 1.0731f)
+	for(float y = -8.f; y < 8.f; y += 0.0731f)
+	{
+		glm::aligned_vec4 const p = glm::fastPow(glm::aligned_vec4(x, x, 1.f / x, x), glm::aligned_vec4(y, -y, y, y * 0.5f));
+		glm::aligned_vec4 const q(x, x, 1.f / x, x);
+		glm::aligned_vec4 const r(y, -y, y, y * 0.5f);
+		for(glm::length_t i = 0; i < 4; ++i)
+		{
+			double const Log2 = std::log(static_cast<double>(q[i])) / std::log(2.0);
+			double const Pow = std::pow(static_cast<double>(q[i]), static_cast<double>(r[i]));
+			Error += std::abs(p[i] - Pow) <= (4e-7 + 1e-7 * std::abs(r[i] * Log2)) * Pow ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+#endif//GLM_CONFIG_SIMD == GLM_ENABLE
 
 int main()
 {
 	int Error(0);
 
+#	if GLM_CONFIG_SIMD == GLM_ENABLE
+		Error += test_simd();
+#	endif
+
 	return Error;
 }
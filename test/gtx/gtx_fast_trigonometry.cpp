@@ -8,6 +8,9 @@
 #include <glm/gtc/constants.hpp>
 #include <glm/gtc/vec1.hpp>
 #include <glm/trigonometric.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 #include <cmath>
 #include <ctime>
 #include <cstdio>
@@ -573,10 +576,39 @@ namespace taylor2
 
 }//namespace taylor2
 
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+namespace simd
+{
+	// Bound documented for the SIMD path of aligned vec4, checked against libm in double
+	static int test()
+	{
+		int Error = 0;
+
+		for(float x = -8192.f; x < 8192.f; x += 0.0371f)
+		{
+			glm::aligned_vec4 const v(x, x * 0.5f, x * 0.125f, x * 0.001f);
+			glm::aligned_vec4 const s = glm::fastSin(v);
+			glm::aligned_vec4 const c = glm::fastCos(v);
+			for(glm::length_t i = 0; i < 4; ++i)
+			{
+				Error += std::abs(s[i] - std::sin(static_cast<double>(v[i]))) <= 1.2e-5 ? 0 : 1;
+				Error += std::abs(c[i] - std::cos(static_cast<double>(v[i]))) <= 1.2e-5 ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+}//namespace simd
+#endif//GLM_CONFIG_SIMD == GLM_ENABLE
+
 int main()
 {
 	int Error(0);
 
+#	if GLM_CONFIG_SIMD == GLM_ENABLE
+		Error += ::simd::test();
+#	endif
+
 	Error += ::taylor2::perf(1000);
 	Error += ::taylorCos::test();
 	Error += ::taylorCos::perf(1000);
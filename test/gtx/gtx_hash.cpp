@@ -11,6 +11,10 @@
 #include <glm/gtx/hash.hpp>
 
 #include <unordered_map>
+#include <cstdio>
+#include <ctime>
+#include <limits>
+#include <vector>
 
 static int test_compile()
 {
@@ -55,11 +59,164 @@ static int test_compile()
     return Error > 0 ? 0 : 1;
 }
 
+static int test_equal_values()
+{
+    int Error = 0;
+
+    std::hash<glm::vec3> Hasher;
+    Error += Hasher(glm::vec3(0.0f, 1.0f, 2.0f)) == Hasher(glm::vec3(-0.0f, 1.0f, 2.0f)) ? 0 : 1;
+    Error += Hasher(glm::vec3(1.0f, 2.0f, 3.0f)) == Hasher(glm::vec3(1.0f, 2.0f, 3.0f)) ? 0 : 1;
+    Error += Hasher(glm::vec3(1.0f, 2.0f, 3.0f)) != Hasher(glm::vec3(3.0f, 2.0f, 1.0f)) ? 0 : 1;
+
+    float const NaN = std::numeric_limits<float>::quiet_NaN();
+    Error += Hasher(glm::vec3(NaN, 1.0f, 2.0f)) == Hasher(glm::vec3(-NaN, 1.0f, 2.0f)) ? 0 : 1;
+
+    std::hash<glm::dmat4> MatHasher;
+    Error += MatHasher(glm::dmat4(0.0)) == MatHasher(glm::dmat4(-0.0)) ? 0 : 1;
+
+#   if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+        // the padding of the columns is not hashed
+        typedef glm::mat<3, 3, float, glm::aligned_highp> aligned_mat3;
+        std::hash<aligned_mat3> AlignedHasher;
+        aligned_mat3 const A(1.0f);
+        aligned_mat3 const B(glm::mat3(1.0f));
+        Error += AlignedHasher(A) == AlignedHasher(B) ? 0 : 1;
+#   endif
+
+    return Error;
+}
+
+// the previous std::hash specializations, combining the std::hash of each component
+template<typename vecType>
+struct legacy_hash
+{
+    size_t operator()(vecType const& v) const
+    {
+        size_t Seed = 0;
+        std::hash<typename vecType::value_type> Hasher;
+        for(glm::length_t i = 0; i < v.length(); ++i)
+            glm::detail::hash_combine(Seed, Hasher(v[i]));
+        return Seed;
+    }
+};
+
+// origins of 64^3 voxel chunks of Stride^3 voxels, put in a table of 2^18 slots indexed by the low bits
+// of the hash, like open addressing maps do. Returns how many keys land in an occupied slot.
+template<typename hasher>
+static int slot_collisions(int Stride)
+{
+    hasher Hasher;
+    std::vector<bool> Used(1 << 18, false);
+    int Collisions = 0;
+    for(int z = 0; z < 64; ++z)
+    for(int y = 0; y < 64; ++y)
+    for(int x = 0; x < 64; ++x)
+    {
+        std::size_t const Slot = Hasher(glm::ivec3(x, y, z) * Stride) & ((1 << 18) - 1);
+        Collisions += Used[Slot] ? 1 : 0;
+        Used[Slot] = true;
+    }
+    return Collisions;
+}
+
+static int test_distribution()
+{
+    int Error = 0;
+
+    int const Strides[] = {1, 16, 64, 1024};
+    for(std::size_t i = 0; i < sizeof(Strides) / sizeof(Strides[0]); ++i)
+    {
+        int const Legacy = slot_collisions<legacy_hash<glm::ivec3> >(Strides[i]);
+        int const Mixed = slot_collisions<std::hash<glm::ivec3> >(Strides[i]);
+        std::printf("ivec3 chunk origins, stride %d: %d collisions with the legacy hash, %d with std::hash\n", Strides[i], Legacy, Mixed);
+
+        // a random hash puts about 37% of the keys in an occupied slot at load factor 1
+        Error += Mixed < 64 * 64 * 64 * 2 / 5 ? 0 : 1;
+    }
+
+    return Error;
+}
+
+template<typename hasher>
+static int perf_map(std::vector<glm::ivec3> const& Keys, char const* Name)
+{
+    std::clock_t const TimeStart = std::clock();
+
+    std::unordered_map<glm::ivec3, int, hasher> Map;
+    for(std::size_t i = 0; i < Keys.size(); ++i)
+        ++Map[Keys[i]];
+
+    int Found = 0;
+    for(std::size_t i = 0; i < Keys.size(); ++i)
+        Found += Map.count(Keys[i] + glm::ivec3(0, 0, 1)) ? 1 : 0;
+
+    std::clock_t const TimeEnd = std::clock();
+    std::printf("%s: %d clocks\n", Name, static_cast<int>(TimeEnd - TimeStart));
+
+    return Found;
+}
+
+template<typename vecType, typename hasher>
+static size_t perf_hash(std::vector<vecType> const& Keys, char const* Name)
+{
+    hasher Hasher;
+    size_t Sum = 0;
+
+    std::clock_t const TimeStart = std::clock();
+    for(int Repeat = 0; Repeat < 16; ++Repeat)
+    for(std::size_t i = 0; i < Keys.size(); ++i)
+        Sum += Hasher(Keys[i]);
+    std::clock_t const TimeEnd = std::clock();
+
+    std::printf("%s: %d clocks\n", Name, static_cast<int>(TimeEnd - TimeStart));
+    return Sum;
+}
+
+// the cells of a 64^3 grid, as voxel chunks or a vertex dedup map would use them
+static int perf_ivec3()
+{
+    int const Size = 64;
+    std::vector<glm::ivec3> Keys;
+    std::vector<glm::vec3> Positions;
+    Keys.reserve(static_cast<std::size_t>(Size * Size * Size));
+    Positions.reserve(static_cast<std::size_t>(Size * Size * Size));
+    for(int z = 0; z < Size; ++z)
+    for(int y = 0; y < Size; ++y)
+    for(int x = 0; x < Size; ++x)
+    {
+        Keys.push_back(glm::ivec3(x, y, z));
+        Positions.push_back(glm::vec3(Keys.back()) * 0.125f);
+    }
+
+    size_t Sum = 0;
+    Sum += perf_hash<glm::ivec3, legacy_hash<glm::ivec3> >(Keys, "hash ivec3, legacy");
+    Sum += perf_hash<glm::ivec3, std::hash<glm::ivec3> >(Keys, "hash ivec3, std::hash");
+    Sum += perf_hash<glm::vec3, legacy_hash<glm::vec3> >(Positions, "hash vec3, legacy");
+    Sum += perf_hash<glm::vec3, std::hash<glm::vec3> >(Positions, "hash vec3, std::hash");
+
+    std::vector<glm::ivec3> Origins(Keys.size());
+    for(std::size_t i = 0; i < Keys.size(); ++i)
+        Origins[i] = Keys[i] * 64;
+
+    int const DenseLegacy = perf_map<legacy_hash<glm::ivec3> >(Keys, "unordered_map<ivec3> dense, legacy");
+    int const DenseMixed = perf_map<std::hash<glm::ivec3> >(Keys, "unordered_map<ivec3> dense, std::hash");
+    int const OriginsLegacy = perf_map<legacy_hash<glm::ivec3> >(Origins, "unordered_map<ivec3> stride 64, legacy");
+    int const OriginsMixed = perf_map<std::hash<glm::ivec3> >(Origins, "unordered_map<ivec3> stride 64, std::hash");
+
+    int Error = Sum != 0 ? 0 : 1;
+    Error += DenseLegacy == DenseMixed ? 0 : 1;
+    Error += OriginsLegacy == OriginsMixed ? 0 : 1;
+    return Error;
+}
+
 int main()
 {
     int Error = 0;
 
     Error += test_compile();
+    Error += test_equal_values();
+    Error += test_distribution();
+    Error += perf_ivec3();
 
     return Error;
 }
@@ -0,0 +1,122 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/matrix_affine.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/constants.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+static glm::mat4 model(float Angle, glm::vec3 const& Axis, glm::vec3 const& Translation, glm::vec3 const& Scale)
+{
+	return glm::scale(glm::rotate(glm::translate(glm::mat4(1.0f), Translation), Angle, Axis), Scale);
+}
+
+static int test_conversion()
+{
+	int Error = 0;
+
+	glm::mat4 const M = model(1.2f, glm::vec3(1, 2, 3), glm::vec3(4, -5, 6), glm::vec3(2, 1, 0.5f));
+	glm::mat3x4 const A = glm::affineFromMat4(M);
+
+	Error += glm::all(glm::equal(A, glm::transpose(glm::mat4x3(M)), 0.0f)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::affineToMat4(A), M, 0.0f)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::affineTranslation(A), glm::vec3(4, -5, 6), 0.0f)) ? 0 : 1;
+
+	glm::vec3 const P(0.5f, -1.5f, 3.0f);
+	Error += glm::all(glm::equal(glm::affineTransformPoint(A, P), glm::vec3(M * glm::vec4(P, 1.0f)), 0.00001f)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::affineTransformVector(A, P), glm::vec3(M * glm::vec4(P, 0.0f)), 0.00001f)) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_compose()
+{
+	int Error = 0;
+
+	glm::mat4 const M0 = model(0.7f, glm::vec3(0, 1, 0), glm::vec3(1, 2, 3), glm::vec3(1, 2, 3));
+	glm::mat4 const M1 = model(-2.1f, glm::vec3(1, 1, 0), glm::vec3(-3, 0, 8), glm::vec3(0.25f));
+
+	glm::mat3x4 const A = glm::affineCompose(glm::affineFromMat4(M0), glm::affineFromMat4(M1));
+	Error += glm::all(glm::equal(glm::affineToMat4(A), M0 * M1, 0.00001f)) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_inverse()
+{
+	int Error = 0;
+
+	glm::mat4 const Scaled = model(0.7f, glm::vec3(2, 1, 0), glm::vec3(1, 2, 3), glm::vec3(1, 2, 3));
+	glm::mat3x4 const A = glm::affineFromMat4(Scaled);
+	Error += glm::all(glm::equal(glm::affineToMat4(glm::affineInverse(A)), glm::inverse(Scaled), 0.00001f)) ? 0 : 1;
+
+	glm::mat4 const Rigid = model(2.5f, glm::vec3(1, -2, 3), glm::vec3(-4, 5, 6), glm::vec3(1));
+	glm::mat3x4 const B = glm::affineFromMat4(Rigid);
+	Error += glm::all(glm::equal(glm::affineToMat4(glm::affineInverseRigid(B)), glm::inverse(Rigid), 0.00001f)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::affineCompose(B, glm::affineInverseRigid(B)), glm::affineFromMat4(glm::mat4(1.0f)), 0.00001f)) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_constexpr()
+{
+#	if GLM_CONFIG_CONSTEXP == GLM_ENABLE
+		constexpr glm::mat3x4 A = glm::affineFromMat4(glm::translate(glm::mat4(1.0f), glm::vec3(1, 2, 3)));
+		constexpr glm::mat3x4 B = glm::affineCompose(A, A);
+		static_assert(glm::affineTranslation(B) == glm::vec3(2, 4, 6), "GLM: Failed constexpr");
+		static_assert(glm::affineTransformPoint(glm::affineInverseRigid(B), glm::vec3(2, 4, 6)) == glm::vec3(0), "GLM: Failed constexpr");
+#	endif//GLM_CONFIG_CONSTEXP == GLM_ENABLE
+
+	return 0;
+}
+
+// propagates the transforms of a tree where node i is a child of node i / 8, parents come first
+static int perf_compose(std::size_t Count)
+{
+	int Error = 0;
+
+	std::vector<glm::mat4> Locals(Count);
+	std::vector<glm::mat3x4> AffineLocals(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Locals[i] = model(0.001f * static_cast<float>(i), glm::vec3(0, 1, 0), glm::vec3(0.001f, 0, 0), glm::vec3(1));
+		AffineLocals[i] = glm::affineFromMat4(Locals[i]);
+	}
+
+	std::vector<glm::mat4> Worlds(Count);
+	std::vector<glm::mat3x4> AffineWorlds(Count);
+
+	std::clock_t const TimeStart = std::clock();
+	Worlds[0] = Locals[0];
+	for(std::size_t i = 1; i < Count; ++i)
+		Worlds[i] = Worlds[i / 8] * Locals[i];
+
+	std::clock_t const TimeMat4 = std::clock();
+	AffineWorlds[0] = AffineLocals[0];
+	for(std::size_t i = 1; i < Count; ++i)
+		AffineWorlds[i] = glm::affineCompose(AffineWorlds[i / 8], AffineLocals[i]);
+
+	std::clock_t const TimeAffine = std::clock();
+
+	std::printf("mat4 compose: %d clocks\n", static_cast<int>(TimeMat4 - TimeStart));
+	std::printf("affineCompose: %d clocks\n", static_cast<int>(TimeAffine - TimeMat4));
+
+	Error += glm::all(glm::equal(glm::affineToMat4(AffineWorlds[Count - 1]), Worlds[Count - 1], 0.001f)) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_conversion();
+	Error += test_compose();
+	Error += test_inverse();
+	Error += test_constexpr();
+	Error += perf_compose(4096);
+
+	return Error;
+}
@@ -48,12 +48,51 @@ static int test_scale_translate() {
 	return Error;
 }
 
+static int test_batch_trs() {
+	int Error = 0;
+
+	glm::mat4 Matrices[4];
+	Matrices[0] = glm::mat4(1);
+	Matrices[1] = glm::scale(glm::translate(glm::mat4(1), glm::vec3(1, 2, 3)), glm::vec3(2, 3, 4));
+	Matrices[2] = glm::scale(glm::rotate(glm::translate(glm::mat4(1), glm::vec3(-5, 0, 7)), 2.5f, glm::normalize(glm::vec3(1, -2, 3))), glm::vec3(0.5f, 1.0f, 8.0f));
+	// mirrored
+	Matrices[3] = glm::scale(glm::rotate(glm::mat4(1), glm::pi<float>() * 0.9f, glm::vec3(0, 1, 0)), glm::vec3(-1.5f, 1.5f, 1.5f));
+
+	glm::vec3 Scales[4];
+	glm::quat Orientations[4];
+	glm::vec3 Translations[4];
+	glm::decomposeTRS(Matrices, 4, Scales, Orientations, Translations);
+
+	for(int i = 0; i < 4; ++i)
+	{
+		glm::vec3 Scale, Translation, Skew;
+		glm::quat Orientation;
+		glm::vec4 Perspective;
+		glm::decompose(Matrices[i], Scale, Orientation, Translation, Skew, Perspective);
+		Error += glm::all(glm::equal(Scales[i], Scale, 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(Translations[i], Translation, 0.0001f)) ? 0 : 1;
+		Error += glm::abs(glm::dot(Orientations[i], Orientation)) > 0.9999f ? 0 : 1;
+	}
+
+	// blended orientations are not unit length
+	Orientations[2] *= 3.0f;
+
+	glm::mat3x4 Affines[4];
+	glm::recomposeTRS(Scales, Orientations, Translations, 4, Affines);
+
+	for(int i = 0; i < 4; ++i)
+		Error += glm::all(glm::equal(Affines[i], glm::transpose(glm::mat4x3(Matrices[i])), 0.0001f)) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
 
 	Error += test_identity();
 	Error += test_scale_translate();
+	Error += test_batch_trs();
 
 	return Error;
 }
@@ -3,6 +3,7 @@
 #include <glm/gtx/pca.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtx/string_cast.hpp>
+#include <glm/gtx/component_wise.hpp>
 
 #include <cstdio>
 #include <vector>
@@ -504,6 +505,123 @@ static int testCovar(
 	return 0;
 }
 
+// Test the streaming accumulator against the two-pass computation
+template<glm::length_t D, typename T, glm::qualifier Q>
+static int testAccumulator(
+#if GLM_HAS_CXX11_STL == 1
+	glm::length_t dataSize, unsigned int randomEngineSeed
+#else // GLM_HAS_CXX11_STL == 1
+	glm::length_t, unsigned int
+#endif // GLM_HAS_CXX11_STL == 1
+)
+{
+	typedef glm::vec<D, T, Q> vec;
+	typedef glm::mat<D, D, T, Q> mat;
+
+	// #1: fixed data set, one point at a time
+	std::vector<vec> testData;
+	agarose::fillTestData(testData);
+
+	glm::covarianceAccumulator<D, T, Q> single;
+	for(std::size_t i = 0; i < testData.size(); ++i)
+		single.add(testData[i]);
+	if(single.count != testData.size())
+		return failReport(__LINE__);
+	if(!vectorEpsilonEqual(single.mean, computeCenter(testData), myEpsilon<T>()))
+		return failReport(__LINE__);
+	if(!matrixEpsilonEqual(single.covariance(), mat(agarose::expectedCovarData()), myEpsilon<T>()))
+		return failReport(__LINE__);
+
+	glm::covarianceAccumulator<D, T, Q> empty;
+	if(!matrixEpsilonEqual(empty.covariance(), mat(0), myEpsilon<T>()))
+		return failReport(__LINE__);
+
+	// #2: random data far from the origin, in blocks and in merged chunks
+#if GLM_HAS_CXX11_STL == 1
+	std::default_random_engine rndEng(randomEngineSeed);
+	std::normal_distribution<T> normalDist;
+	testData.resize(dataSize);
+	T offset[D];
+	for(glm::length_t d = 0; d < D; ++d)
+		offset[d] = static_cast<T>(100) * normalDist(rndEng);
+	for(glm::length_t i = 0; i < dataSize; ++i)
+		for(glm::length_t d = 0; d < D; ++d)
+			testData[i][d] = offset[d] + normalDist(rndEng);
+
+	vec const center = computeCenter(testData);
+	mat const expected = glm::computeCovarianceMatrix(testData.data(), testData.size(), center);
+	T const epsilon = static_cast<T>(100) * myEpsilon<T>();
+
+	glm::covarianceAccumulator<D, T, Q> block;
+	block.add(testData.data(), testData.size());
+	if(!vectorEpsilonEqual(block.mean, center, epsilon))
+		return failReport(__LINE__);
+	if(!matrixEpsilonEqual(block.covariance(), expected, epsilon))
+		return failReport(__LINE__);
+
+	// uneven chunks, merged into an empty accumulator and in a tree
+	std::size_t const split[4] = {0, 1, 300, testData.size()};
+	glm::covarianceAccumulator<D, T, Q> chunks[3];
+	for(int c = 0; c < 3; ++c)
+		chunks[c].add(testData.data() + split[c], split[c + 1] - split[c]);
+	glm::covarianceAccumulator<D, T, Q> merged;
+	chunks[1].merge(chunks[2]);
+	merged.merge(chunks[0]);
+	merged.merge(chunks[1]);
+	if(merged.count != testData.size())
+		return failReport(__LINE__);
+	if(!vectorEpsilonEqual(merged.mean, center, epsilon))
+		return failReport(__LINE__);
+	if(!matrixEpsilonEqual(merged.covariance(), expected, epsilon))
+		return failReport(__LINE__);
+#endif // GLM_HAS_CXX11_STL == 1
+	return 0;
+}
+
+// Checks A * v = lambda * v and orthonormal eigenvectors for a few 3x3 matrices with special structure
+template<typename T>
+static int testEigenvectors3(T epsilon)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec;
+	typedef glm::mat<3, 3, T, glm::defaultp> mat;
+
+	// a rotation, to hide the structure from the solver
+	mat const r = mat(
+		T(2), T(-1), T(2),
+		T(2), T(2), T(-1),
+		T(-1), T(2), T(2)) / T(3);
+
+	mat const tests[] = {
+		mat(0),
+		mat(T(1)),
+		mat(vec(T(3), 0, 0), vec(0, T(-2), 0), vec(0, 0, T(7))),
+		// repeated eigenvalue 2 and a single 5
+		r * mat(vec(T(2), 0, 0), vec(0, T(2), 0), vec(0, 0, T(5))) * glm::transpose(r),
+		// close eigenvalues
+		r * mat(vec(T(1), 0, 0), vec(0, T(1.0001), 0), vec(0, 0, T(1000))) * glm::transpose(r)
+	};
+
+	for(std::size_t t = 0; t < sizeof(tests) / sizeof(tests[0]); ++t)
+	{
+		vec eigenvalues;
+		mat eigenvectors;
+		if(glm::findEigenvaluesSymReal(tests[t], eigenvalues, eigenvectors) != 3u)
+			return failReport(__LINE__);
+
+		T const scale = glm::max(T(1), glm::compMax(glm::abs(eigenvalues)));
+		for(int i = 0; i < 3; ++i)
+		{
+			if(!vectorEpsilonEqual(tests[t] * eigenvectors[i] / scale, eigenvectors[i] * eigenvalues[i] / scale, epsilon))
+				return failReport(__LINE__);
+			for(int j = 0; j < 3; ++j)
+				if(!glm::epsilonEqual(glm::dot(eigenvectors[i], eigenvectors[j]), T(i == j ? 1 : 0), epsilon))
+					return failReport(__LINE__);
+		}
+	}
+
+	return 0;
+}
+
 // Computes eigenvalues and eigenvectors from well-known covariance matrix
 template<glm::length_t D, typename T, glm::qualifier Q>
 static int testEigenvectors(T epsilon)
@@ -697,6 +815,22 @@ int main()
 	if (error != 0)
 		return error;
 
+	// test streaming covariance against the two-pass result
+	if(testAccumulator<2, float, glm::defaultp>(1000, 12345) != 0)
+		error = failReport(__LINE__);
+	if(testAccumulator<2, double, glm::defaultp>(1000, 42) != 0)
+		error = failReport(__LINE__);
+	if(testAccumulator<3, float, glm::defaultp>(1000, 2021) != 0)
+		error = failReport(__LINE__);
+	if(testAccumulator<3, double, glm::defaultp>(1000, 815) != 0)
+		error = failReport(__LINE__);
+	if(testAccumulator<4, float, glm::defaultp>(1000, 3141) != 0)
+		error = failReport(__LINE__);
+	if(testAccumulator<4, double, glm::defaultp>(1000, 174) != 0)
+		error = failReport(__LINE__);
+	if (error != 0)
+		return error;
+
 	// test PCA eigen vector reconstruction
 	// Expected epsilon precision evaluated separately:
 	// https://github.com/sgrottel/exp-pca-precision
@@ -712,6 +846,10 @@ int main()
 		error = failReport(__LINE__);
 	if(testEigenvectors<4, double, glm::defaultp>(0.0000001) != 0)
 		error = failReport(__LINE__);
+	if(testEigenvectors3<float>(0.00001f) != 0)
+		error = failReport(__LINE__);
+	if(testEigenvectors3<double>(0.0000000001) != 0)
+		error = failReport(__LINE__);
 	if(error != 0)
 		return error;
 
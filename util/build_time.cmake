@@ -0,0 +1,75 @@
+# Compares the time spent building the GLM test suite with plain headers, with the
+# precompiled header (GLM_BUILD_PCH) and with the C++20 module (GLM_BUILD_MODULE).
+#
+#   cmake [-DBENCH_DIR=<dir>] [-DBENCH_GENERATOR=<generator>] [-DBENCH_OPTIONS=<-D...;-D...>] -P util/build_time.cmake
+#
+# Each mode is configured in <dir>/<mode>, with Ninja when found, and built from
+# clean with one job so the numbers don't depend on the core count. The module mode
+# needs CMake 3.28, a Ninja or Visual Studio generator and GCC 14, Clang 16 or
+# Visual C++ 17.4. The tests keep including the headers in this mode: the module
+# interface and the 'import glm;' test are timed separately as the cost a module
+# consumer pays.
+
+cmake_minimum_required(VERSION 3.23)
+
+get_filename_component(GLM_SOURCE_DIR "${CMAKE_CURRENT_LIST_DIR}/.." ABSOLUTE)
+if(NOT BENCH_DIR)
+	set(BENCH_DIR "${CMAKE_CURRENT_BINARY_DIR}/glm_build_time")
+endif()
+if(NOT BENCH_GENERATOR)
+	find_program(BENCH_NINJA ninja)
+	if(BENCH_NINJA)
+		set(BENCH_GENERATOR "Ninja")
+	endif()
+endif()
+if(BENCH_GENERATOR)
+	set(BENCH_GENERATOR_OPTION -G "${BENCH_GENERATOR}")
+endif()
+
+function(glm_time OUTPUT)
+	string(TIMESTAMP Begin "%s%f" UTC)
+	execute_process(COMMAND ${ARGN} RESULT_VARIABLE Result OUTPUT_QUIET ERROR_QUIET)
+	string(TIMESTAMP End "%s%f" UTC)
+	if(NOT Result EQUAL 0)
+		set(${OUTPUT} "failed" PARENT_SCOPE)
+		return()
+	endif()
+	math(EXPR Milliseconds "(${End} - ${Begin}) / 1000")
+	math(EXPR Seconds "${Milliseconds} / 1000")
+	math(EXPR Fraction "1000 + ${Milliseconds} % 1000")
+	string(SUBSTRING "${Fraction}" 1 3 Fraction)
+	set(${OUTPUT} "${Seconds}.${Fraction}s" PARENT_SCOPE)
+endfunction()
+
+function(glm_bench MODE)
+	set(BinaryDir "${BENCH_DIR}/${MODE}")
+	file(REMOVE_RECURSE "${BinaryDir}")
+	execute_process(
+		COMMAND "${CMAKE_COMMAND}" -S "${GLM_SOURCE_DIR}" -B "${BinaryDir}" ${BENCH_GENERATOR_OPTION}
+			-DCMAKE_BUILD_TYPE=Release -DGLM_BUILD_TESTS=ON -DGLM_BUILD_LIBRARY=OFF -DGLM_BUILD_INSTALL=OFF -DGLM_QUIET=ON
+			${BENCH_OPTIONS} ${ARGN}
+		RESULT_VARIABLE Result OUTPUT_QUIET)
+	if(NOT Result EQUAL 0)
+		message(STATUS "${MODE}: configuration failed")
+		return()
+	endif()
+
+	set(Build "${CMAKE_COMMAND}" --build "${BinaryDir}" --parallel 1)
+	if(MODE STREQUAL "module")
+		if(NOT EXISTS "${BinaryDir}/test/core/CMakeFiles/test-core_cpp_module.dir")
+			message(STATUS "${MODE}: glm::glm-module unavailable with this CMake, generator or compiler")
+			return()
+		endif()
+		glm_time(Interface ${Build} --target glm-module)
+		glm_time(Consumer ${Build} --target test-core_cpp_module)
+		glm_time(Total ${Build})
+		message(STATUS "${MODE}: module interface ${Interface}, 'import glm;' test ${Consumer}, header tests ${Total}")
+	else()
+		glm_time(Total ${Build})
+		message(STATUS "${MODE}: test suite ${Total}")
+	endif()
+endfunction()
+
+glm_bench(header)
+glm_bench(pch -DGLM_BUILD_PCH=ON)
+glm_bench(module -DGLM_BUILD_MODULE=ON -DGLM_ENABLE_CXX_20=ON)